@@ -18,6 +18,15 @@ void batch_norm_tiled_e32m2(const float* input, float* output, const float* scal
 void batch_norm_tiled_e32m4(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon);
 void batch_norm_tiled_e32m8(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon);
 
+// Blocked NCHW[block] layout ([C / block][H][W][block], block <= lanes of one register group)
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block);
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block);
+
+void batch_norm_nchwc_e32m1(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block);
+void batch_norm_nchwc_e32m2(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block);
+void batch_norm_nchwc_e32m4(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block);
+void batch_norm_nchwc_e32m8(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block);
+
 // Utility functions
 void write_matrix_to_file(const char* filename, float* matrix, std::size_t rows, std::size_t cols);
 void write_matrix_binary(const char* filename, float* matrix, std::size_t count);
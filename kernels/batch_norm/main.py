@@ -55,6 +55,9 @@ c_tiled_e32m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/batch_norm_
 c_tiled_e32m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/batch_norm_tiled_e32m4.bin"), dtype=np.float32).reshape(output_size)
 c_tiled_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/batch_norm_tiled_e32m8.bin"), dtype=np.float32).reshape(output_size)
 
+# ==== C Blocked NCHW[c] (e32mx) ====
+c_nchwc = [np.fromfile(os.path.join(SCRIPT_DIR, f"./output_files/batch_norm_nchwc_e32m{m}.bin"), dtype=np.float32).reshape(output_size) for m in (1, 2, 4, 8)]
+
 # ONNX --> golden reference
 c_ref = onnx_ref_flat
 
@@ -71,6 +74,10 @@ implementations = [
     ("C Tiled Vectorized (e32m2)", c_tiled_e32m2),
     ("C Tiled Vectorized (e32m4)", c_tiled_e32m4),
     ("C Tiled Vectorized (e32m8)", c_tiled_e32m8),  
+    ("C NCHW4c (e32m1)", c_nchwc[0]),
+    ("C NCHW8c (e32m2)", c_nchwc[1]),
+    ("C NCHW16c (e32m4)", c_nchwc[2]),
+    ("C NCHW32c (e32m8)", c_nchwc[3]),
 ]
 
 print(f"\n{'Implementation':<30}{'Max Abs Error':<20}{'SNR (dB)':<20}")
@@ -99,6 +99,45 @@ int main(int argc, char* argv[]) {
     batch_norm_tiled_e32m8(input_original, output, scale, bias, mean, variance, C, H, W, epsilon);
     write_matrix_binary("./output_files/batch_norm_tiled_e32m8.bin", output, output_size);
 
+    /***** BatchNorm on blocked NCHW[c] (block = one register group at VLEN = 128) *****/
+    {
+        // Sized for the widest block (32)
+        size_t blocked_size = (C + 31) / 32 * 32 * H * W;
+        float* in_b = new float[blocked_size];
+        float* out_b = new float[blocked_size];
+
+        for (size_t n = 0; n < N; ++n) {
+            nchw_to_nchwc(input_original + n * C * H * W, in_b, C, H, W, 4);
+            batch_norm_nchwc_e32m1(in_b, out_b, scale, bias, mean, variance, C, H, W, epsilon, 4);
+            nchwc_to_nchw(out_b, output + n * C * H * W, C, H, W, 4);
+        }
+        write_matrix_binary("./output_files/batch_norm_nchwc_e32m1.bin", output, output_size);
+
+        for (size_t n = 0; n < N; ++n) {
+            nchw_to_nchwc(input_original + n * C * H * W, in_b, C, H, W, 8);
+            batch_norm_nchwc_e32m2(in_b, out_b, scale, bias, mean, variance, C, H, W, epsilon, 8);
+            nchwc_to_nchw(out_b, output + n * C * H * W, C, H, W, 8);
+        }
+        write_matrix_binary("./output_files/batch_norm_nchwc_e32m2.bin", output, output_size);
+
+        for (size_t n = 0; n < N; ++n) {
+            nchw_to_nchwc(input_original + n * C * H * W, in_b, C, H, W, 16);
+            batch_norm_nchwc_e32m4(in_b, out_b, scale, bias, mean, variance, C, H, W, epsilon, 16);
+            nchwc_to_nchw(out_b, output + n * C * H * W, C, H, W, 16);
+        }
+        write_matrix_binary("./output_files/batch_norm_nchwc_e32m4.bin", output, output_size);
+
+        for (size_t n = 0; n < N; ++n) {
+            nchw_to_nchwc(input_original + n * C * H * W, in_b, C, H, W, 32);
+            batch_norm_nchwc_e32m8(in_b, out_b, scale, bias, mean, variance, C, H, W, epsilon, 32);
+            nchwc_to_nchw(out_b, output + n * C * H * W, C, H, W, 32);
+        }
+        write_matrix_binary("./output_files/batch_norm_nchwc_e32m8.bin", output, output_size);
+
+        delete[] in_b;
+        delete[] out_b;
+    }
+
     cout << "C++ kernels completed." << endl;
 
     // --- CLEANUP ---
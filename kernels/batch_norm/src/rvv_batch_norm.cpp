@@ -1,6 +1,7 @@
 #include <cstddef>
 #include <riscv_vector.h>
 #include "rvv_defs.hpp"
+#include "rvv_nchwc.hpp"
 #include <cmath>
 
 using namespace std;
@@ -218,4 +219,32 @@ void batch_norm_tiled_e32m8(const float* input, float* output, const float* scal
             i += vl;
         }
     }
-}
\ No newline at end of file
+}
+
+/****************************** Blocked NCHW[c] Layout ******************************/
+// Input and output are [C / block][H][W][block] (rvv_nchwc.hpp): alpha / beta of a channel
+// block are one vector each, applied to every pixel with unit-stride loads.
+
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block) {
+    nchw_to_nchwc<M8>(src, dst, channels, height, width, block);
+}
+
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block) {
+    nchwc_to_nchw<M8>(src, dst, channels, height, width, block);
+}
+
+void batch_norm_nchwc_e32m1(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block) {
+    batch_norm_nchwc<M1>(input, output, scale, bias, mean, variance, channels, height, width, epsilon, block);
+}
+
+void batch_norm_nchwc_e32m2(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block) {
+    batch_norm_nchwc<M2>(input, output, scale, bias, mean, variance, channels, height, width, epsilon, block);
+}
+
+void batch_norm_nchwc_e32m4(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block) {
+    batch_norm_nchwc<M4>(input, output, scale, bias, mean, variance, channels, height, width, epsilon, block);
+}
+
+void batch_norm_nchwc_e32m8(const float* input, float* output, const float* scale, const float* bias, const float* mean, const float* variance, int channels, int height, int width, float epsilon, int block) {
+    batch_norm_nchwc<M8>(input, output, scale, bias, mean, variance, channels, height, width, epsilon, block);
+}
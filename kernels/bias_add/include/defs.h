@@ -17,6 +17,19 @@ void bias_add_e32m4(const float* input, const float* bias, float* output,
 void bias_add_e32m8(const float* input, const float* bias, float* output,
 					size_t channels, size_t channel_size);
 
+// --- Blocked NCHW[block] layout ([C / block][H][W][block], block <= lanes of one register group) ---
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block);
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block);
+
+void bias_add_nchwc_e32m1(const float* input, const float* bias, float* output,
+					size_t channels, size_t height, size_t width, size_t block);
+void bias_add_nchwc_e32m2(const float* input, const float* bias, float* output,
+					size_t channels, size_t height, size_t width, size_t block);
+void bias_add_nchwc_e32m4(const float* input, const float* bias, float* output,
+					size_t channels, size_t height, size_t width, size_t block);
+void bias_add_nchwc_e32m8(const float* input, const float* bias, float* output,
+					size_t channels, size_t height, size_t width, size_t block);
+
 // --- Utils ---
 void write_matrix_to_file(const char* filename, float* matrix, std::size_t rows, std::size_t cols);
 void write_matrix_binary(const char* filename, float* matrix, std::size_t count);
@@ -80,6 +80,10 @@ implementations = [
     ("C Vectorized (e32m2)", load_data("bias_add_e32m2.bin", output_shape)),
     ("C Vectorized (e32m4)", load_data("bias_add_e32m4.bin", output_shape)),
     ("C Vectorized (e32m8)", load_data("bias_add_e32m8.bin", output_shape)),
+    ("C NCHW4c (e32m1)", load_data("bias_add_nchwc_e32m1.bin", output_shape)),
+    ("C NCHW8c (e32m2)", load_data("bias_add_nchwc_e32m2.bin", output_shape)),
+    ("C NCHW16c (e32m4)", load_data("bias_add_nchwc_e32m4.bin", output_shape)),
+    ("C NCHW32c (e32m8)", load_data("bias_add_nchwc_e32m8.bin", output_shape)),
 ]
 
 # ==== Results Table ====
@@ -76,6 +76,45 @@ int main(int argc, char* argv[]) {
     bias_add_e32m8(input, bias, output, C, H * W);
     write_matrix_binary("./output_files/bias_add_e32m8.bin", output, output_size);
 
+    /***** BiasAdd on blocked NCHW[c] (block = one register group at VLEN = 128) *****/
+    {
+        // Sized for the widest block (32)
+        size_t blocked_size = (C + 31) / 32 * 32 * H * W;
+        float* in_b = new float[blocked_size];
+        float* out_b = new float[blocked_size];
+
+        for (size_t b = 0; b < B; ++b) {
+            nchw_to_nchwc(input + b * C * H * W, in_b, C, H, W, 4);
+            bias_add_nchwc_e32m1(in_b, bias, out_b, C, H, W, 4);
+            nchwc_to_nchw(out_b, output + b * C * H * W, C, H, W, 4);
+        }
+        write_matrix_binary("./output_files/bias_add_nchwc_e32m1.bin", output, output_size);
+
+        for (size_t b = 0; b < B; ++b) {
+            nchw_to_nchwc(input + b * C * H * W, in_b, C, H, W, 8);
+            bias_add_nchwc_e32m2(in_b, bias, out_b, C, H, W, 8);
+            nchwc_to_nchw(out_b, output + b * C * H * W, C, H, W, 8);
+        }
+        write_matrix_binary("./output_files/bias_add_nchwc_e32m2.bin", output, output_size);
+
+        for (size_t b = 0; b < B; ++b) {
+            nchw_to_nchwc(input + b * C * H * W, in_b, C, H, W, 16);
+            bias_add_nchwc_e32m4(in_b, bias, out_b, C, H, W, 16);
+            nchwc_to_nchw(out_b, output + b * C * H * W, C, H, W, 16);
+        }
+        write_matrix_binary("./output_files/bias_add_nchwc_e32m4.bin", output, output_size);
+
+        for (size_t b = 0; b < B; ++b) {
+            nchw_to_nchwc(input + b * C * H * W, in_b, C, H, W, 32);
+            bias_add_nchwc_e32m8(in_b, bias, out_b, C, H, W, 32);
+            nchwc_to_nchw(out_b, output + b * C * H * W, C, H, W, 32);
+        }
+        write_matrix_binary("./output_files/bias_add_nchwc_e32m8.bin", output, output_size);
+
+        delete[] in_b;
+        delete[] out_b;
+    }
+
     // --- CLEANUP ---
     delete[] input;
     delete[] bias;
@@ -1,6 +1,7 @@
 #include <cstddef>
 #include <riscv_vector.h>
 #include "rvv_defs.hpp"
+#include "rvv_nchwc.hpp"
 
 using namespace std;
 
@@ -144,4 +145,36 @@ void bias_add_e32m8(const float* input, const float* bias, float* output,
         // When this while loop ends, in_ptr and out_ptr are already
         // perfectly positioned for the start of the next channel.
     }
-}
\ No newline at end of file
+}
+
+/****************************** Blocked NCHW[c] Layout ******************************/
+// Input and output are [C / block][H][W][block] (rvv_nchwc.hpp): the bias of a channel
+// block is one vector, added to every pixel with unit-stride loads.
+
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block) {
+    nchw_to_nchwc<M8>(src, dst, channels, height, width, block);
+}
+
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block) {
+    nchwc_to_nchw<M8>(src, dst, channels, height, width, block);
+}
+
+void bias_add_nchwc_e32m1(const float* input, const float* bias, float* output,
+                          size_t channels, size_t height, size_t width, size_t block) {
+    bias_add_nchwc<M1>(input, bias, output, channels, height, width, block);
+}
+
+void bias_add_nchwc_e32m2(const float* input, const float* bias, float* output,
+                          size_t channels, size_t height, size_t width, size_t block) {
+    bias_add_nchwc<M2>(input, bias, output, channels, height, width, block);
+}
+
+void bias_add_nchwc_e32m4(const float* input, const float* bias, float* output,
+                          size_t channels, size_t height, size_t width, size_t block) {
+    bias_add_nchwc<M4>(input, bias, output, channels, height, width, block);
+}
+
+void bias_add_nchwc_e32m8(const float* input, const float* bias, float* output,
+                          size_t channels, size_t height, size_t width, size_t block) {
+    bias_add_nchwc<M8>(input, bias, output, channels, height, width, block);
+}
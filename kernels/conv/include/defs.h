@@ -3,6 +3,12 @@
 
 #include <cstddef>
 
+// Activations for conv2d_im2col_gemm_fused_m8
+#define CONV_ACT_NONE       0
+#define CONV_ACT_RELU       1
+#define CONV_ACT_LEAKY_RELU 2
+#define CONV_ACT_CLIP       3
+
 // RVV optimized 2D convolution functions
 void conv2d_e32m1(
     const float* input, const float* kernel, float* output,
@@ -28,6 +34,64 @@ void conv2d_e32m8(
     int input_h, int input_w, int kernel_h, int kernel_w,
     int stride_h, int stride_w, int pad_h, int pad_w);
 
+// Grouped / dilated direct convolution: kernel [out_channels][in_channels / group][kH][kW],
+// tap (kh, kw) at input offset (kh * dilation_h, kw * dilation_w)
+void conv2d_grouped_e32m1(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w,
+    int dilation_h, int dilation_w, int group);
+
+void conv2d_grouped_e32m2(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w,
+    int dilation_h, int dilation_w, int group);
+
+void conv2d_grouped_e32m4(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w,
+    int dilation_h, int dilation_w, int group);
+
+void conv2d_grouped_e32m8(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w,
+    int dilation_h, int dilation_w, int group);
+
+// Conv weights packed once ([OC][IC][KH][KW] -> [IC][KH][KW][OC]) into a caller-owned
+// handle, consumed by the conv2d_e32m*_prepacked variants
+struct PackedConvWeights;
+
+PackedConvWeights* pack_conv_weights(const float* kernel,
+    int in_channels, int out_channels, int kernel_h, int kernel_w);
+void free_packed_conv_weights(PackedConvWeights* w);
+
+void conv2d_e32m1_prepacked(
+    const float* input, const PackedConvWeights* w, float* output,
+    int batch_size, int input_h, int input_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_e32m2_prepacked(
+    const float* input, const PackedConvWeights* w, float* output,
+    int batch_size, int input_h, int input_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_e32m4_prepacked(
+    const float* input, const PackedConvWeights* w, float* output,
+    int batch_size, int input_h, int input_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_e32m8_prepacked(
+    const float* input, const PackedConvWeights* w, float* output,
+    int batch_size, int input_h, int input_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
 // Scalar reference implementation
 void conv2d_scalar(
     const float* input, const float* kernel, float* output,
@@ -48,16 +112,19 @@ void gemm_blocked_scalar(const float* A, const float* B, float* C,
                          int M, int N, int K,
                          int BM, int BN, int BK);
 
-void gemm_blocked_e32m8(const float* A, const float* B, float* C,
-                        int M, int N, int K,
-                        int BM, int BN, int BK);
-
 void im2col_e32m8(const float* data_im, float* data_col,
                   int channels, int height, int width,
                   int kernel_h, int kernel_w,
                   int pad_h, int pad_w,
                   int stride_h, int stride_w);
 
+void im2col_dilated_e32m8(const float* data_im, float* data_col,
+                          int channels, int height, int width,
+                          int kernel_h, int kernel_w,
+                          int pad_h, int pad_w,
+                          int stride_h, int stride_w,
+                          int dilation_h, int dilation_w);
+
 // Im2Col-GEMM convolution functions
 void conv2d_im2col_gemm_scalar(
     const float* input, const float* weights, const float* bias,
@@ -70,7 +137,7 @@ void conv2d_im2col_gemm_scalar(
 void conv2d_im2col_gemm_vector(
     const float* input, const float* weights, const float* bias,
     float* output,
-    float* col_buf, float* gemm_buf,
+    float* col_buf,
     int C, int H, int W, int M, int KH, int KW,
     int pad_h, int pad_w, int stride_h, int stride_w,
     int has_bias);
@@ -78,14 +145,198 @@ void conv2d_im2col_gemm_vector(
 void conv2d_im2col_gemm_m8(
     const float* input, const float* kernel, const float* bias,
     float* output,
-    float* col_buf, float* gemm_buf,
+    float* col_buf,
     int in_channels, int input_h, int input_w, 
     int out_channels, int kernel_h, int kernel_w,
     int pad_h, int pad_w, int stride_h, int stride_w,
     int has_bias);
 
+// Grouped / dilated im2col + GEMM (one GEMM per group, col_buf sized as for group = 1)
+void conv2d_im2col_gemm_grouped_m8(
+    const float* input, const float* kernel, const float* bias,
+    float* output,
+    float* col_buf,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int dilation_h, int dilation_w, int group,
+    int has_bias);
+
+// Im2Col-GEMM streamed over bands of output rows: the col workspace is bounded by
+// CONV_IM2COL_WORKSPACE floats instead of K x out_h * out_w, so no col_buf is passed.
+// Opt-in: no model calls it (LeNet and tiny-YOLOv2 run the implicit GEMM, no col buffer)
+void conv2d_im2col_gemm_streamed_m8(
+    const float* input, const float* kernel, const float* bias,
+    float* output,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int dilation_h, int dilation_w,
+    int has_bias);
+
+// Im2Col-GEMM with fused bias / folded BN / residual / activation epilogue (a null
+// shift is taken as 0, a null scale as 1)
+void conv2d_im2col_gemm_fused_m8(
+    const float* input, const float* kernel,
+    const float* bias, const float* scale, const float* shift, const float* residual,
+    float* output, float* col_buf,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int activation, float alpha, float clip_min, float clip_max);
+
+// Implicit-GEMM convolution: im2col gathered while packing GEMM panels, no col_buf
+void conv2d_implicit_gemm_m8(
+    const float* input, const float* kernel, const float* bias,
+    float* output,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int has_bias);
+
+void conv2d_implicit_gemm_fused_m8(
+    const float* input, const float* kernel,
+    const float* bias, const float* scale, const float* shift, const float* residual,
+    float* output,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int activation, float alpha, float clip_min, float clip_max);
+
+// Winograd F(2x2,3x3) / F(4x4,3x3) for 3x3 stride-1 layers (tile_m = 2 or 4, anything
+// else throws std::invalid_argument). Filters transformed once into a caller-owned handle,
+// or on every call.
+struct WinogradConvWeights;
+
+WinogradConvWeights* pack_winograd_weights(const float* kernel,
+    int in_channels, int out_channels, int tile_m);
+void free_winograd_weights(WinogradConvWeights* w);
+
+void conv2d_winograd_m8_prepacked(
+    const float* input, const WinogradConvWeights* w, float* output,
+    int batch_size, int input_h, int input_w, int pad_h, int pad_w);
+
+void conv2d_winograd_m8(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int pad_h, int pad_w, int tile_m);
+
+// Blocked NCHW[block] layout: converted at the model boundary, consumed by the
+// conv2d_nchwc_* variants (single image, block <= lanes of one register group)
+struct NchwcConvWeights;
+
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block);
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block);
+
+// Weights and the (optional, nullable) bias packed once per layer
+NchwcConvWeights* pack_nchwc_weights(const float* kernel, const float* bias,
+    int in_channels, int out_channels, int kernel_h, int kernel_w, int block);
+void free_nchwc_weights(NchwcConvWeights* w);
+
+void conv2d_nchwc_e32m1(
+    const float* input, const NchwcConvWeights* w, float* output,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_nchwc_e32m2(
+    const float* input, const NchwcConvWeights* w, float* output,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_nchwc_e32m4(
+    const float* input, const NchwcConvWeights* w, float* output,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_nchwc_e32m8(
+    const float* input, const NchwcConvWeights* w, float* output,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+// Depthwise convolution: output channel c * multiplier + j filters input channel c,
+// kernel [channels * multiplier][kH][kW]
+void depthwise_conv2d_scalar(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int channels, int multiplier,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+void depthwise_conv2d_e32m1(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int channels, int multiplier,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+void depthwise_conv2d_e32m2(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int channels, int multiplier,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+void depthwise_conv2d_e32m4(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int channels, int multiplier,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+void depthwise_conv2d_e32m8(
+    const float* input, const float* kernel, float* output,
+    int batch_size, int channels, int multiplier,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w);
+
+// Depthwise -> bias -> act -> 1x1 conv [out_channels][channels * multiplier] -> bias -> act,
+// the depthwise output never leaving cache (activation: CONV_ACT_*)
+void depthwise_pointwise_conv2d_m8(
+    const float* input, const float* dw_kernel, const float* dw_bias,
+    const float* pw_kernel, const float* pw_bias, float* output,
+    int batch_size, int channels, int multiplier, int out_channels,
+    int input_h, int input_w, int kernel_h, int kernel_w,
+    int stride_h, int stride_w, int pad_h, int pad_w,
+    int activation, float alpha, float clip_min, float clip_max);
+
+// Multi-channel direct 3x3 convolution (kernel [out_channels][in_channels][3][3], any
+// stride / padding, optional bias), output channels register-blocked
+void conv2d_3x3_direct_m1(
+    const float* input, const float* kernel, const float* bias, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_3x3_direct_m2(
+    const float* input, const float* kernel, const float* bias, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_3x3_direct_m4(
+    const float* input, const float* kernel, const float* bias, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+void conv2d_3x3_direct_m8(
+    const float* input, const float* kernel, const float* bias, float* output,
+    int batch_size, int in_channels, int out_channels,
+    int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w);
+
+// Dispatching convolution: implicit GEMM per image
+void conv2d(
+	const float* input, float* output, const float* weights,
+	int batch,
+	int in_channels, int in_height, int in_width,
+	int out_channels,
+	int kernel_h, int kernel_w,
+	int stride_h, int stride_w,
+	int pad_h, int pad_w);
+
+// Per-layer Winograd handle for the overload below: built for 3x3 stride-1 layers,
+// nullptr for every other layer (free with free_winograd_weights)
+WinogradConvWeights* pack_conv2d_weights(
+	const float* weights,
+	int in_channels, int in_height, int in_width,
+	int out_channels,
+	int kernel_h, int kernel_w,
+	int stride_h, int stride_w,
+	int pad_h, int pad_w);
+
+// Same, Winograd from the prebuilt handle when prepacked is non-null
 void conv2d(
 	const float* input, float* output, const float* weights,
+	const WinogradConvWeights* prepacked,
 	int batch,
 	int in_channels, int in_height, int in_width,
 	int out_channels,
@@ -93,6 +344,17 @@ void conv2d(
 	int stride_h, int stride_w,
 	int pad_h, int pad_w);
 
+// Same, with ONNX group / dilations: group == in_channels runs the depthwise kernel
+void conv2d_grouped(
+	const float* input, float* output, const float* weights,
+	int batch,
+	int in_channels, int in_height, int in_width,
+	int out_channels,
+	int kernel_h, int kernel_w,
+	int stride_h, int stride_w,
+	int pad_h, int pad_w,
+	int dilation_h, int dilation_w, int group);
+
 // 3x3 specialized RVV functions
 void conv2d_3x3_m1(
     const float* input, const float* kernel, float* output,
@@ -2,6 +2,7 @@ import numpy as np
 import onnx
 import onnxruntime as ort
 import sys
+import math
 import os
 import subprocess
 
@@ -14,7 +15,7 @@ os.makedirs(OUT_DIR, exist_ok=True)
 from src.onnx_utils import max_abs_error, snr_db
 
 
-def build_dynamic_conv_model(weight, bias, kH, kW, sH, sW, pH, pW):
+def build_dynamic_conv_model(weight, bias, kH, kW, sH, sW, pH, pW, group=1, dH=1, dW=1):
     """Build an ONNX Conv model programmatically with provided weights/bias.
     Inputs:  input [N,C,H,W]
     Outputs: output [N,Cout,Hout,Wout]
@@ -23,7 +24,7 @@ def build_dynamic_conv_model(weight, bias, kH, kW, sH, sW, pH, pW):
     from onnx import helper, TensorProto
 
     N = None  # dynamic
-    Cin = weight.shape[1]
+    Cin = weight.shape[1] * group
     Cout = weight.shape[0]
 
     input_tensor = helper.make_tensor_value_info("input", TensorProto.FLOAT, [None, Cin, None, None])
@@ -52,8 +53,8 @@ def build_dynamic_conv_model(weight, bias, kH, kW, sH, sW, pH, pW):
         kernel_shape=[kH, kW],
         strides=[sH, sW],
         pads=[pH, pW, pH, pW],
-        dilations=[1, 1],
-        group=1,
+        dilations=[dH, dW],
+        group=group,
     )
 
     graph = helper.make_graph(
@@ -74,8 +75,9 @@ def run():
     kH, kW = 3, 3
     sH, sW = 1, 1
     pH, pW = 1, 1
+    dH, dW, G = 2, 2, 0
 
-    # Parse CLI like run_conv2d.cpp: N Cin Cout H W [kH kW sH sW pH pW]
+    # Parse CLI like run_conv2d.cpp: N Cin Cout H W [kH kW sH sW pH pW] [dH dW G]
     args = sys.argv[1:]
     if len(args) >= 5:
         N, Cin, Cout, H, W = map(int, args[:5])
@@ -85,6 +87,10 @@ def run():
         sH, sW = map(int, args[7:9])
     if len(args) >= 11:
         pH, pW = map(int, args[9:11])
+    if len(args) >= 14:
+        dH, dW, G = map(int, args[11:14])
+    if G == 0:
+        G = math.gcd(Cin, Cout)
 
     # Paths to I/O binaries
     input_path = os.path.join(OUT_DIR, "input.bin")
@@ -124,7 +130,26 @@ def run():
     c_e32m2 = load("c_e32m2.bin")
     c_e32m4 = load("c_e32m4.bin")
     c_e32m8 = load("c_e32m8.bin")
+    c_e32m1_pp = load("c_e32m1_prepacked.bin")
+    c_e32m2_pp = load("c_e32m2_prepacked.bin")
+    c_e32m4_pp = load("c_e32m4_prepacked.bin")
+    c_e32m8_pp = load("c_e32m8_prepacked.bin")
     c_conv2d = load("c_conv2d.bin")
+    c_conv2d_pp = load("c_conv2d_prepacked.bin")
+    c_nchwc = [load(f"c_nchwc_e32m{m}.bin") for m in (1, 2, 4, 8)]
+    c_im2col = load("c_im2col.bin")
+    c_implicit = load("c_implicit.bin")
+    c_streamed = load("c_im2col_streamed.bin")
+    c_fused = load("c_fused.bin")
+    c_fused_implicit = load("c_fused_implicit.bin")
+
+    # Fused epilogue reference: bias -> folded BN -> residual -> LeakyReLU(0.1)
+    bias = np.fromfile(os.path.join(OUT_DIR, "bias.bin"), dtype=np.float32).reshape(1, Cout, 1, 1)
+    scale = np.fromfile(os.path.join(OUT_DIR, "scale.bin"), dtype=np.float32).reshape(1, Cout, 1, 1)
+    shift = np.fromfile(os.path.join(OUT_DIR, "shift.bin"), dtype=np.float32).reshape(1, Cout, 1, 1)
+    residual = load("residual.bin")
+    fused_ref = (onnx_ref + bias) * scale + shift + residual
+    fused_ref = np.where(fused_ref < 0, 0.1 * fused_ref, fused_ref)
 
     # Results table
     implementations = [
@@ -134,7 +159,19 @@ def run():
         ("C Vectorized (e32m2)", c_e32m2),
         ("C Vectorized (e32m4)", c_e32m4),
         ("C Vectorized (e32m8)", c_e32m8),
-        ("C IM2COL + GEMM (m8)", c_conv2d),
+        ("C Prepacked (e32m1)", c_e32m1_pp),
+        ("C Prepacked (e32m2)", c_e32m2_pp),
+        ("C Prepacked (e32m4)", c_e32m4_pp),
+        ("C Prepacked (e32m8)", c_e32m8_pp),
+        ("C IM2COL + GEMM (m8)", c_im2col),
+        ("C Implicit GEMM (m8)", c_implicit),
+        ("C IM2COL streamed (m8)", c_streamed),
+        ("C conv2d", c_conv2d),
+        ("C conv2d (prepacked)", c_conv2d_pp),
+        ("C NCHW4c (e32m1)", c_nchwc[0]),
+        ("C NCHW8c (e32m2)", c_nchwc[1]),
+        ("C NCHW16c (e32m4)", c_nchwc[2]),
+        ("C NCHW32c (e32m8)", c_nchwc[3]),
     ]
 
     print(f"\nConv2D: N={N} Cin={Cin} Cout={Cout} HxW={H}x{W} k={kH}x{kW} stride=({sH},{sW}) pad=({pH},{pW})")
@@ -149,6 +186,90 @@ def run():
         snr = snr_db(ref, result)
         print(f"{name:<25}{mae:<20.6g}{snr:<20.6g}")
 
+    mae = max_abs_error(fused_ref, c_fused)
+    snr = snr_db(fused_ref, c_fused)
+    print(f"{'C IM2COL + GEMM fused':<25}{mae:<20.6g}{snr:<20.6g}")
+
+    mae = max_abs_error(fused_ref, c_fused_implicit)
+    snr = snr_db(fused_ref, c_fused_implicit)
+    print(f"{'C Implicit GEMM fused':<25}{mae:<20.6g}{snr:<20.6g}")
+
+    # Multi-channel direct 3x3
+    if kH == 3 and kW == 3:
+        print(f"\n{'Direct 3x3 vs ONNX':<25}{'Max Abs Error':<20}{'SNR (dB)':<20}")
+        print("-" * 60)
+        for m in (1, 2, 4, 8):
+            result = load(f"c_3x3_direct_m{m}.bin")
+            print(f"{f'C Direct 3x3 (m{m})':<25}{max_abs_error(onnx_ref, result):<20.6g}{snr_db(onnx_ref, result):<20.6g}")
+
+    # Winograd (3x3, stride 1): transform round-off checked against the scalar direct conv
+    if kH == 3 and kW == 3 and sH == 1 and sW == 1:
+        print(f"\n{'Winograd vs C Scalar':<25}{'Max Abs Error':<20}{'SNR (dB)':<20}")
+        print("-" * 60)
+        for name, fname in [("F(2x2,3x3)", "c_winograd_f2.bin"), ("F(4x4,3x3)", "c_winograd_f4.bin")]:
+            result = load(fname)
+            mae = max_abs_error(c_scalar, result)
+            snr = snr_db(c_scalar, result)
+            print(f"{name:<25}{mae:<20.6g}{snr:<20.6g}")
+
+    # Depthwise (multiplier 2): ONNX Conv with group = Cin
+    mult = 2
+    dwC = Cin * mult
+    dw_kernel = np.fromfile(os.path.join(OUT_DIR, "dw_kernel.bin"), dtype=np.float32).reshape(dwC, 1, kH, kW)
+    dw_model = build_dynamic_conv_model(dw_kernel, bias=None, kH=kH, kW=kW, sH=sH, sW=sW, pH=pH, pW=pW, group=Cin)
+    dw_session = ort.InferenceSession(dw_model.SerializeToString())
+    dw_ref = dw_session.run(None, {dw_session.get_inputs()[0].name: A.astype(np.float32)})[0]
+
+    def load_dw(name):
+        return np.fromfile(os.path.join(OUT_DIR, name), dtype=np.float32).reshape(N, dwC, outH, outW)
+
+    print(f"\n{'Depthwise vs ONNX':<25}{'Max Abs Error':<20}{'SNR (dB)':<20}")
+    print("-" * 60)
+    for name, fname in [("C Scalar", "c_dw_scalar.bin"), ("C Depthwise (e32m1)", "c_dw_e32m1.bin"),
+                        ("C Depthwise (e32m2)", "c_dw_e32m2.bin"), ("C Depthwise (e32m4)", "c_dw_e32m4.bin"),
+                        ("C Depthwise (e32m8)", "c_dw_e32m8.bin")]:
+        result = load_dw(fname)
+        print(f"{name:<25}{max_abs_error(dw_ref, result):<20.6g}{snr_db(dw_ref, result):<20.6g}")
+
+    # Fused depthwise -> pointwise: bias + LeakyReLU(0.1) after both stages
+    dw_bias = np.fromfile(os.path.join(OUT_DIR, "dw_bias.bin"), dtype=np.float32).reshape(1, dwC, 1, 1)
+    pw_kernel = np.fromfile(os.path.join(OUT_DIR, "pw_kernel.bin"), dtype=np.float32).reshape(Cout, dwC)
+    pw_bias = np.fromfile(os.path.join(OUT_DIR, "pw_bias.bin"), dtype=np.float32).reshape(1, Cout, 1, 1)
+    dw_act = dw_ref + dw_bias
+    dw_act = np.where(dw_act < 0, 0.1 * dw_act, dw_act)
+    dw_pw_ref = np.einsum("oc,nchw->nohw", pw_kernel, dw_act) + pw_bias
+    dw_pw_ref = np.where(dw_pw_ref < 0, 0.1 * dw_pw_ref, dw_pw_ref)
+    c_dw_pw = load("c_dw_pw.bin")
+    print(f"{'C Depthwise+Pointwise':<25}{max_abs_error(dw_pw_ref, c_dw_pw):<20.6g}{snr_db(dw_pw_ref, c_dw_pw):<20.6g}")
+
+    # Grouped + dilated: ONNX Conv with group = G, dilations = (dH, dW)
+    outH_g = (H + 2 * pH - dH * (kH - 1) - 1) // sH + 1
+    outW_g = (W + 2 * pW - dW * (kW - 1) - 1) // sW + 1
+    if Cin % G == 0 and Cout % G == 0 and outH_g > 0 and outW_g > 0:
+        g_kernel = np.fromfile(os.path.join(OUT_DIR, "grp_kernel.bin"), dtype=np.float32).reshape(Cout, Cin // G, kH, kW)
+        g_bias = np.fromfile(os.path.join(OUT_DIR, "grp_bias.bin"), dtype=np.float32).reshape(1, Cout, 1, 1)
+        g_model = build_dynamic_conv_model(g_kernel, bias=None, kH=kH, kW=kW, sH=sH, sW=sW, pH=pH, pW=pW,
+                                           group=G, dH=dH, dW=dW)
+        g_session = ort.InferenceSession(g_model.SerializeToString())
+        g_ref = g_session.run(None, {g_session.get_inputs()[0].name: A.astype(np.float32)})[0]
+
+        def load_grp(name):
+            return np.fromfile(os.path.join(OUT_DIR, name), dtype=np.float32).reshape(N, Cout, outH_g, outW_g)
+
+        print(f"\n{f'Group={G} Dilation=({dH},{dW})':<25}{'Max Abs Error':<20}{'SNR (dB)':<20}")
+        print("-" * 60)
+        for name, fname, ref_g in [("C Grouped (e32m1)", "c_grp_e32m1.bin", g_ref),
+                                   ("C Grouped (e32m2)", "c_grp_e32m2.bin", g_ref),
+                                   ("C Grouped (e32m4)", "c_grp_e32m4.bin", g_ref),
+                                   ("C Grouped (e32m8)", "c_grp_e32m8.bin", g_ref),
+                                   ("C IM2COL + GEMM + bias", "c_grp_im2col.bin", g_ref + g_bias),
+                                   ("C conv2d_grouped", "c_grp_conv2d.bin", g_ref)]:
+            result = load_grp(fname)
+            print(f"{name:<25}{max_abs_error(ref_g, result):<20.6g}{snr_db(ref_g, result):<20.6g}")
+
+    # The implicit GEMM forms the same sums as im2col + GEMM
+    print(f"\nImplicit vs im2col bit-identical: {np.array_equal(c_implicit, c_im2col)}")
+
 
 if __name__ == "__main__":
     run()
@@ -2,6 +2,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <numeric>
 #include "./include/defs.h"
 
 using namespace std;
@@ -27,10 +28,13 @@ int main(int argc, char* argv[]) {
     int sW = 1;          // stride width
     int pH = 1;          // pad height
     int pW = 1;          // pad width
+    int dH = 2;          // dilation height (grouped / dilated section)
+    int dW = 2;          // dilation width
+    int G = 0;           // group count (0: gcd(Cin, Cout))
 
 
     // Parse arguments (optional):
-    // argv: N Cin Cout H W [kH kW sH sW pH pW]
+    // argv: N Cin Cout H W [kH kW sH sW pH pW] [dH dW G]
     if (argc >= 6) {
         N   = max(1, atoi(argv[1]));
         Cin = max(1, atoi(argv[2]));
@@ -50,6 +54,12 @@ int main(int argc, char* argv[]) {
         pH = max(0, atoi(argv[10]));
         pW = max(0, atoi(argv[11]));
     }
+    if (argc >= 15) {
+        dH = max(1, atoi(argv[12]));
+        dW = max(1, atoi(argv[13]));
+        G  = max(0, atoi(argv[14]));
+    }
+    if (G == 0) G = gcd(Cin, Cout);
 
     // Derived sizes
     int in_size = N * Cin * H * W;
@@ -108,6 +118,125 @@ int main(int argc, char* argv[]) {
                  N, Cin, Cout, H, W, kH, kW, sH, sW, pH, pW);
     write_matrix_binary("./output_files/c_e32m8.bin", out_buf, static_cast<size_t>(out_size));
 
+    // Prepacked weights: packed once, reused by every LMUL variant
+    PackedConvWeights* packed = pack_conv_weights(kernel, Cin, Cout, kH, kW);
+
+    conv2d_e32m1_prepacked(input, packed, out_buf, N, H, W, sH, sW, pH, pW);
+    write_matrix_binary("./output_files/c_e32m1_prepacked.bin", out_buf, static_cast<size_t>(out_size));
+
+    conv2d_e32m2_prepacked(input, packed, out_buf, N, H, W, sH, sW, pH, pW);
+    write_matrix_binary("./output_files/c_e32m2_prepacked.bin", out_buf, static_cast<size_t>(out_size));
+
+    conv2d_e32m4_prepacked(input, packed, out_buf, N, H, W, sH, sW, pH, pW);
+    write_matrix_binary("./output_files/c_e32m4_prepacked.bin", out_buf, static_cast<size_t>(out_size));
+
+    conv2d_e32m8_prepacked(input, packed, out_buf, N, H, W, sH, sW, pH, pW);
+    write_matrix_binary("./output_files/c_e32m8_prepacked.bin", out_buf, static_cast<size_t>(out_size));
+
+    free_packed_conv_weights(packed);
+
+    // Explicit im2col + GEMM (col_buf) vs implicit GEMM (no col_buf)
+    {
+        float* col_buf = new float[Cin * kH * kW * outH * outW];
+        for (int n = 0; n < N; ++n) {
+            conv2d_im2col_gemm_m8(input + n * Cin * H * W, kernel, nullptr,
+                                  out_buf + n * Cout * outH * outW, col_buf,
+                                  Cin, H, W, Cout, kH, kW, pH, pW, sH, sW, 0);
+        }
+        write_matrix_binary("./output_files/c_im2col.bin", out_buf, static_cast<size_t>(out_size));
+        delete[] col_buf;
+
+        for (int n = 0; n < N; ++n) {
+            conv2d_implicit_gemm_m8(input + n * Cin * H * W, kernel, nullptr,
+                                    out_buf + n * Cout * outH * outW,
+                                    Cin, H, W, Cout, kH, kW, pH, pW, sH, sW, 0);
+        }
+        write_matrix_binary("./output_files/c_implicit.bin", out_buf, static_cast<size_t>(out_size));
+
+        // Streamed im2col: col built per band of output rows within a fixed workspace
+        for (int n = 0; n < N; ++n) {
+            conv2d_im2col_gemm_streamed_m8(input + n * Cin * H * W, kernel, nullptr,
+                                           out_buf + n * Cout * outH * outW,
+                                           Cin, H, W, Cout, kH, kW, pH, pW, sH, sW, 1, 1, 0);
+        }
+        write_matrix_binary("./output_files/c_im2col_streamed.bin", out_buf, static_cast<size_t>(out_size));
+    }
+
+    // Winograd (3x3, stride 1 only): filters transformed once, accuracy checked in main.py
+    if (kH == 3 && kW == 3 && sH == 1 && sW == 1) {
+        WinogradConvWeights* wino2 = pack_winograd_weights(kernel, Cin, Cout, 2);
+        conv2d_winograd_m8_prepacked(input, wino2, out_buf, N, H, W, pH, pW);
+        write_matrix_binary("./output_files/c_winograd_f2.bin", out_buf, static_cast<size_t>(out_size));
+        free_winograd_weights(wino2);
+
+        WinogradConvWeights* wino4 = pack_winograd_weights(kernel, Cin, Cout, 4);
+        conv2d_winograd_m8_prepacked(input, wino4, out_buf, N, H, W, pH, pW);
+        write_matrix_binary("./output_files/c_winograd_f4.bin", out_buf, static_cast<size_t>(out_size));
+        free_winograd_weights(wino4);
+    }
+
+	// Multi-channel direct 3x3 (register-blocked output channels)
+	if (kH == 3 && kW == 3) {
+		conv2d_3x3_direct_m1(input, kernel, nullptr, out_buf, N, Cin, Cout, H, W, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_3x3_direct_m1.bin", out_buf, static_cast<size_t>(out_size));
+
+		conv2d_3x3_direct_m2(input, kernel, nullptr, out_buf, N, Cin, Cout, H, W, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_3x3_direct_m2.bin", out_buf, static_cast<size_t>(out_size));
+
+		conv2d_3x3_direct_m4(input, kernel, nullptr, out_buf, N, Cin, Cout, H, W, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_3x3_direct_m4.bin", out_buf, static_cast<size_t>(out_size));
+
+		conv2d_3x3_direct_m8(input, kernel, nullptr, out_buf, N, Cin, Cout, H, W, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_3x3_direct_m8.bin", out_buf, static_cast<size_t>(out_size));
+	}
+
+	// Blocked NCHW[c]: convert in, run, convert out; block = lanes of one register group of
+	// the variant at VLEN = 128 (4 / 8 / 16 / 32), buffers sized for the widest block
+	{
+		float* in_b = new float[(Cin + 31) / 32 * 32 * H * W];
+		float* out_b = new float[(Cout + 31) / 32 * 32 * outH * outW];
+		NchwcConvWeights* wb;
+
+		wb = pack_nchwc_weights(kernel, nullptr, Cin, Cout, kH, kW, 4);
+		for (int n = 0; n < N; ++n) {
+			nchw_to_nchwc(input + n * Cin * H * W, in_b, Cin, H, W, 4);
+			conv2d_nchwc_e32m1(in_b, wb, out_b, H, W, sH, sW, pH, pW);
+			nchwc_to_nchw(out_b, out_buf + n * Cout * outH * outW, Cout, outH, outW, 4);
+		}
+		write_matrix_binary("./output_files/c_nchwc_e32m1.bin", out_buf, static_cast<size_t>(out_size));
+		free_nchwc_weights(wb);
+
+		wb = pack_nchwc_weights(kernel, nullptr, Cin, Cout, kH, kW, 8);
+		for (int n = 0; n < N; ++n) {
+			nchw_to_nchwc(input + n * Cin * H * W, in_b, Cin, H, W, 8);
+			conv2d_nchwc_e32m2(in_b, wb, out_b, H, W, sH, sW, pH, pW);
+			nchwc_to_nchw(out_b, out_buf + n * Cout * outH * outW, Cout, outH, outW, 8);
+		}
+		write_matrix_binary("./output_files/c_nchwc_e32m2.bin", out_buf, static_cast<size_t>(out_size));
+		free_nchwc_weights(wb);
+
+		wb = pack_nchwc_weights(kernel, nullptr, Cin, Cout, kH, kW, 16);
+		for (int n = 0; n < N; ++n) {
+			nchw_to_nchwc(input + n * Cin * H * W, in_b, Cin, H, W, 16);
+			conv2d_nchwc_e32m4(in_b, wb, out_b, H, W, sH, sW, pH, pW);
+			nchwc_to_nchw(out_b, out_buf + n * Cout * outH * outW, Cout, outH, outW, 16);
+		}
+		write_matrix_binary("./output_files/c_nchwc_e32m4.bin", out_buf, static_cast<size_t>(out_size));
+		free_nchwc_weights(wb);
+
+		wb = pack_nchwc_weights(kernel, nullptr, Cin, Cout, kH, kW, 32);
+		for (int n = 0; n < N; ++n) {
+			nchw_to_nchwc(input + n * Cin * H * W, in_b, Cin, H, W, 32);
+			conv2d_nchwc_e32m8(in_b, wb, out_b, H, W, sH, sW, pH, pW);
+			nchwc_to_nchw(out_b, out_buf + n * Cout * outH * outW, Cout, outH, outW, 32);
+		}
+		write_matrix_binary("./output_files/c_nchwc_e32m8.bin", out_buf, static_cast<size_t>(out_size));
+		free_nchwc_weights(wb);
+
+		delete[] in_b;
+		delete[] out_b;
+	}
+
 	conv2d(input, out_buf, kernel,
 		N,
 		Cin, H, W,
@@ -116,6 +245,162 @@ int main(int argc, char* argv[]) {
 		sH, sW,
 		pH, pW);  // Assuming square kernel (kH=kW) and uniform stride/padding
  	write_matrix_binary("./output_files/c_conv2d.bin", out_buf, static_cast<size_t>(out_size));
+
+	// Same dispatch with the per-layer handle (Winograd for 3x3 stride 1)
+	WinogradConvWeights* conv_pp = pack_conv2d_weights(kernel, Cin, H, W, Cout, kH, kW, sH, sW, pH, pW);
+	conv2d(input, out_buf, kernel, conv_pp, N, Cin, H, W, Cout, kH, kW, sH, sW, pH, pW);
+	write_matrix_binary("./output_files/c_conv2d_prepacked.bin", out_buf, static_cast<size_t>(out_size));
+	free_winograd_weights(conv_pp);
+
+	// Fused epilogue: bias -> folded BN (scale / shift) -> residual -> LeakyReLU(0.1)
+	{
+		float* bias = new float[Cout];
+		float* scale = new float[Cout];
+		float* shift = new float[Cout];
+		float* residual = new float[out_size];
+		float* col_buf = new float[Cin * kH * kW * outH * outW];
+		for (int c = 0; c < Cout; ++c) {
+			bias[c] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+			scale[c] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f;
+			shift[c] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		for (int i = 0; i < out_size; ++i) {
+			residual[i] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		write_matrix_binary("./output_files/bias.bin", bias, static_cast<size_t>(Cout));
+		write_matrix_binary("./output_files/scale.bin", scale, static_cast<size_t>(Cout));
+		write_matrix_binary("./output_files/shift.bin", shift, static_cast<size_t>(Cout));
+		write_matrix_binary("./output_files/residual.bin", residual, static_cast<size_t>(out_size));
+
+		for (int n = 0; n < N; ++n) {
+			conv2d_im2col_gemm_fused_m8(
+				input + n * Cin * H * W, kernel,
+				bias, scale, shift, residual + n * Cout * outH * outW,
+				out_buf + n * Cout * outH * outW, col_buf,
+				Cin, H, W, Cout, kH, kW, pH, pW, sH, sW,
+				CONV_ACT_LEAKY_RELU, 0.1f, 0.0f, 0.0f);
+		}
+		write_matrix_binary("./output_files/c_fused.bin", out_buf, static_cast<size_t>(out_size));
+
+		for (int n = 0; n < N; ++n) {
+			conv2d_implicit_gemm_fused_m8(
+				input + n * Cin * H * W, kernel,
+				bias, scale, shift, residual + n * Cout * outH * outW,
+				out_buf + n * Cout * outH * outW,
+				Cin, H, W, Cout, kH, kW, pH, pW, sH, sW,
+				CONV_ACT_LEAKY_RELU, 0.1f, 0.0f, 0.0f);
+		}
+		write_matrix_binary("./output_files/c_fused_implicit.bin", out_buf, static_cast<size_t>(out_size));
+
+		delete[] bias;
+		delete[] scale;
+		delete[] shift;
+		delete[] residual;
+		delete[] col_buf;
+	}
+
+	// Depthwise (multiplier 2) on the same input, then fused depthwise -> pointwise to Cout
+	// with bias and LeakyReLU(0.1) after both stages
+	{
+		const int mult = 2;
+		const int dwC = Cin * mult;
+		const int dw_out_size = N * dwC * outH * outW;
+		float* dw_kernel = new float[dwC * kH * kW];
+		float* dw_bias = new float[dwC];
+		float* pw_kernel = new float[Cout * dwC];
+		float* pw_bias = new float[Cout];
+		float* dw_out = new float[dw_out_size];
+		for (int i = 0; i < dwC * kH * kW; ++i) {
+			dw_kernel[i] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		for (int i = 0; i < dwC; ++i) {
+			dw_bias[i] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		for (int i = 0; i < Cout * dwC; ++i) {
+			pw_kernel[i] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		for (int i = 0; i < Cout; ++i) {
+			pw_bias[i] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		write_matrix_binary("./output_files/dw_kernel.bin", dw_kernel, static_cast<size_t>(dwC * kH * kW));
+		write_matrix_binary("./output_files/dw_bias.bin", dw_bias, static_cast<size_t>(dwC));
+		write_matrix_binary("./output_files/pw_kernel.bin", pw_kernel, static_cast<size_t>(Cout * dwC));
+		write_matrix_binary("./output_files/pw_bias.bin", pw_bias, static_cast<size_t>(Cout));
+
+		depthwise_conv2d_scalar(input, dw_kernel, dw_out, N, Cin, mult, H, W, kH, kW, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_dw_scalar.bin", dw_out, static_cast<size_t>(dw_out_size));
+
+		depthwise_conv2d_e32m1(input, dw_kernel, dw_out, N, Cin, mult, H, W, kH, kW, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_dw_e32m1.bin", dw_out, static_cast<size_t>(dw_out_size));
+
+		depthwise_conv2d_e32m2(input, dw_kernel, dw_out, N, Cin, mult, H, W, kH, kW, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_dw_e32m2.bin", dw_out, static_cast<size_t>(dw_out_size));
+
+		depthwise_conv2d_e32m4(input, dw_kernel, dw_out, N, Cin, mult, H, W, kH, kW, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_dw_e32m4.bin", dw_out, static_cast<size_t>(dw_out_size));
+
+		depthwise_conv2d_e32m8(input, dw_kernel, dw_out, N, Cin, mult, H, W, kH, kW, sH, sW, pH, pW);
+		write_matrix_binary("./output_files/c_dw_e32m8.bin", dw_out, static_cast<size_t>(dw_out_size));
+
+		depthwise_pointwise_conv2d_m8(input, dw_kernel, dw_bias, pw_kernel, pw_bias, out_buf,
+		                              N, Cin, mult, Cout, H, W, kH, kW, sH, sW, pH, pW,
+		                              CONV_ACT_LEAKY_RELU, 0.1f, 0.0f, 0.0f);
+		write_matrix_binary("./output_files/c_dw_pw.bin", out_buf, static_cast<size_t>(out_size));
+
+		delete[] dw_kernel;
+		delete[] dw_bias;
+		delete[] pw_kernel;
+		delete[] pw_bias;
+		delete[] dw_out;
+	}
+
+	// Grouped + dilated: weights [Cout][Cin / G][kH][kW], checked against ONNX in main.py
+	int outH_g = (H + 2 * pH - dH * (kH - 1) - 1) / sH + 1;
+	int outW_g = (W + 2 * pW - dW * (kW - 1) - 1) / sW + 1;
+	if (Cin % G == 0 && Cout % G == 0 && H + 2 * pH > dH * (kH - 1) && W + 2 * pW > dW * (kW - 1)) {
+		const int gk_size = Cout * (Cin / G) * kH * kW;
+		const int g_out_size = N * Cout * outH_g * outW_g;
+		float* g_kernel = new float[gk_size];
+		float* g_bias = new float[Cout];
+		float* g_out = new float[g_out_size];
+		float* col_buf = new float[Cin * kH * kW * outH_g * outW_g];
+		for (int i = 0; i < gk_size; ++i) {
+			g_kernel[i] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		for (int i = 0; i < Cout; ++i) {
+			g_bias[i] = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+		}
+		write_matrix_binary("./output_files/grp_kernel.bin", g_kernel, static_cast<size_t>(gk_size));
+		write_matrix_binary("./output_files/grp_bias.bin", g_bias, static_cast<size_t>(Cout));
+
+		conv2d_grouped_e32m1(input, g_kernel, g_out, N, Cin, Cout, H, W, kH, kW, sH, sW, pH, pW, dH, dW, G);
+		write_matrix_binary("./output_files/c_grp_e32m1.bin", g_out, static_cast<size_t>(g_out_size));
+
+		conv2d_grouped_e32m2(input, g_kernel, g_out, N, Cin, Cout, H, W, kH, kW, sH, sW, pH, pW, dH, dW, G);
+		write_matrix_binary("./output_files/c_grp_e32m2.bin", g_out, static_cast<size_t>(g_out_size));
+
+		conv2d_grouped_e32m4(input, g_kernel, g_out, N, Cin, Cout, H, W, kH, kW, sH, sW, pH, pW, dH, dW, G);
+		write_matrix_binary("./output_files/c_grp_e32m4.bin", g_out, static_cast<size_t>(g_out_size));
+
+		conv2d_grouped_e32m8(input, g_kernel, g_out, N, Cin, Cout, H, W, kH, kW, sH, sW, pH, pW, dH, dW, G);
+		write_matrix_binary("./output_files/c_grp_e32m8.bin", g_out, static_cast<size_t>(g_out_size));
+
+		// im2col + GEMM with bias (one GEMM per group)
+		for (int n = 0; n < N; ++n) {
+			conv2d_im2col_gemm_grouped_m8(input + n * Cin * H * W, g_kernel, g_bias,
+			                              g_out + n * Cout * outH_g * outW_g, col_buf,
+			                              Cin, H, W, Cout, kH, kW, pH, pW, sH, sW, dH, dW, G, 1);
+		}
+		write_matrix_binary("./output_files/c_grp_im2col.bin", g_out, static_cast<size_t>(g_out_size));
+
+		conv2d_grouped(input, g_out, g_kernel, N, Cin, H, W, Cout, kH, kW, sH, sW, pH, pW, dH, dW, G);
+		write_matrix_binary("./output_files/c_grp_conv2d.bin", g_out, static_cast<size_t>(g_out_size));
+
+		delete[] g_kernel;
+		delete[] g_bias;
+		delete[] g_out;
+		delete[] col_buf;
+	}
  
 
 	delete[] input;
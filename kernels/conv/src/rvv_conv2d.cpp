@@ -3,9 +3,16 @@
 #include <cstring>
 #include <algorithm>
 #include <cassert>
+#include <stdexcept>
 #include <riscv_vector.h>
 #include "../include/defs.h"
 #include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_conv_gemm.hpp"
+#include "rvv_winograd.hpp"
+#include "rvv_nchwc.hpp"
+#include "rvv_depthwise.hpp"
+#include "rvv_conv3x3.hpp"
 #include <string.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -101,196 +108,171 @@ void conv2d_scalar(
 }
 
 /********************************* General Vectorized Versions *********************************/
-#define MAX_WEIGHT_SIZE 65536
-static float packed_w[MAX_WEIGHT_SIZE];
-
-// RVV optimized 2D convolution (e32m1)
-void conv2d_e32m1(
-	const float* input, const float* kernel, float* output,
-	int batch_size, int in_channels, int out_channels,
-	int input_h, int input_w, int kernel_h, int kernel_w,
-	int stride_h, int stride_w, int pad_h, int pad_w) {
-	
-	int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
-	int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
-	int out_area = out_h * out_w;
-	int in_area = input_h * input_w;
-	int kernel_spatial = kernel_h * kernel_w;
+// Direct convolution vectorized over output channels: one vector of OC accumulators per
+// output pixel, fed by unit-stride loads of weights packed [IC][KH][KW][OC].
+//
+// The packing is a property of the layer, not of the call: pack_conv_weights builds it once
+// into a caller-owned handle and conv2d_e32m*_prepacked consume it, so repeated inference
+// pays no repacking and the kernels share no state (reentrant, no size limit).
+//
+// Grouped convs pack each group on its own ([G][IC / G][KH][KW][OC / G]) and vectorize over
+// the output channels of one group; dilation only moves the input taps.
+
+struct PackedConvWeights {
+	int in_channels = 0;
+	int out_channels = 0;
+	int kernel_h = 0;
+	int kernel_w = 0;
+	std::vector<float> data; // [IC][KH][KW][OC]
+};
+
+// Weight Packing: [OC][IC][KH][KW] -> [IC][KH][KW][OC]
+static void pack_conv_weights_ihwo(const float* kernel, float* packed,
+	int in_channels, int out_channels, int kernel_spatial) {
 
 	for (int ic = 0; ic < in_channels; ++ic) {
 		for (int k = 0; k < kernel_spatial; ++k) {
 			for (int oc = 0; oc < out_channels; ++oc) {
-				packed_w[(ic * kernel_spatial + k) * out_channels + oc] = 
+				packed[(ic * kernel_spatial + k) * out_channels + oc] =
 					kernel[oc * (in_channels * kernel_spatial) + ic * kernel_spatial + k];
 			}
 		}
 	}
+}
 
-	std::memset(output, 0, batch_size * out_channels * out_area * sizeof(float));
+PackedConvWeights* pack_conv_weights(const float* kernel,
+	int in_channels, int out_channels, int kernel_h, int kernel_w) {
+
+	PackedConvWeights* w = new PackedConvWeights;
+	w->in_channels = in_channels;
+	w->out_channels = out_channels;
+	w->kernel_h = kernel_h;
+	w->kernel_w = kernel_w;
+	w->data.resize(static_cast<size_t>(in_channels) * kernel_h * kernel_w * out_channels);
+	pack_conv_weights_ihwo(kernel, w->data.data(), in_channels, out_channels, kernel_h * kernel_w);
+	return w;
+}
 
-	for (int b = 0; b < batch_size; ++b) {
-		for (int oc = 0; oc < out_channels; ) {
-			size_t vl = SET_VECTOR_LENGTH<float, M1>(out_channels - oc);
-			for (int oh = 0; oh < out_h; ++oh) {
-				int ih_base = oh * stride_h - pad_h;
-				for (int ow = 0; ow < out_w; ++ow) {
-					int iw_base = ow * stride_w - pad_w;
-					float* out_ptr = &output[b * out_channels * out_area + oc * out_area + oh * out_w + ow];
-					vfloat32m1_t v_acc = VECTOR_STRIDED_LOAD<float, M1>(out_ptr, out_area * sizeof(float), vl);
-
-					for (int ic = 0; ic < in_channels; ++ic) {
-						const float* w_ic_base = &packed_w[(ic * kernel_spatial) * out_channels + oc];
-						for (int kh = 0; kh < kernel_h; ++kh) {
-							int ih = ih_base + kh;
-							if (ih < 0 || ih >= input_h) continue;
-							for (int kw = 0; kw < kernel_w; ++kw) {
-								int iw = iw_base + kw;
-								if (iw < 0 || iw >= input_w) continue;
-								float scalar_in = input[b * in_channels * in_area + ic * in_area + ih * input_w + iw];
-								vfloat32m1_t v_w = VECTOR_LOAD<float, M1>(w_ic_base + (kh * kernel_w + kw) * out_channels, vl);
-								v_acc = VECTOR_FMACC_VF<float, M1>(v_acc, scalar_in, v_w, vl);
-							}
-						}
-					}
-					VECTOR_STRIDED_STORE<float, M1>(out_ptr, out_area * sizeof(float), v_acc, vl);
-				}
-			}
-			oc += vl;
-		}
-	}
+void free_packed_conv_weights(PackedConvWeights* w) {
+	delete w;
 }
 
-void conv2d_e32m2(
-	const float* input, const float* kernel, float* output,
+template<int LMUL>
+static void conv2d_direct_packed(
+	const float* input, const float* packed_w, float* output,
 	int batch_size, int in_channels, int out_channels,
 	int input_h, int input_w, int kernel_h, int kernel_w,
-	int stride_h, int stride_w, int pad_h, int pad_w) {
-	
-	int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
-	int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
+	int stride_h, int stride_w, int pad_h, int pad_w,
+	int dilation_h = 1, int dilation_w = 1, int group = 1) {
+
+	int out_h = (input_h + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1;
+	int out_w = (input_w + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1;
 	int out_area = out_h * out_w;
 	int in_area = input_h * input_w;
 	int kernel_spatial = kernel_h * kernel_w;
+	int ic_group = in_channels / group;
+	int oc_group = out_channels / group;
 
+	for (int b = 0; b < batch_size; ++b) {
+		for (int g = 0; g < group; ++g) {
+			const float* in_batch_base = &input[(b * in_channels + g * ic_group) * in_area];
+			float* out_batch_base = &output[(b * out_channels + g * oc_group) * out_area];
+			const float* w_group = &packed_w[g * ic_group * kernel_spatial * oc_group];
 
-	// Weight Packing: [OC][IC][KH][KW] -> [IC][KH][KW][OC]
-	for (int ic = 0; ic < in_channels; ++ic) {
-		for (int k = 0; k < kernel_spatial; ++k) {
-			for (int oc = 0; oc < out_channels; ++oc) {
-				packed_w[(ic * kernel_spatial + k) * out_channels + oc] = 
-					kernel[oc * (in_channels * kernel_spatial) + ic * kernel_spatial + k];
-			}
-		}
-	}
+			for (int oc = 0; oc < oc_group; ) {
+				size_t vl = SET_VECTOR_LENGTH<float, LMUL>(oc_group - oc);
 
-	// Initialize output to zero using standard std::memset
-	std::memset(output, 0, batch_size * out_channels * out_area * sizeof(float));
+				for (int oh = 0; oh < out_h; ++oh) {
+					int ih_base = oh * stride_h - pad_h;
+					for (int ow = 0; ow < out_w; ++ow) {
+						int iw_base = ow * stride_w - pad_w;
+						float* out_ptr = out_batch_base + oc * out_area + oh * out_w + ow;
 
-	for (int b = 0; b < batch_size; ++b) {
-		const float* in_batch_base = &input[b * in_channels * in_area];
-		float* out_batch_base = &output[b * out_channels * out_area];
+						auto v_acc = VECTOR_MOVE<float, LMUL>(0.0f, vl);
 
-		for (int oc = 0; oc < out_channels; ) {
-			// Ara VLEN=1024, NR_LANES=4. M2 is safe and efficient.
-			size_t vl = SET_VECTOR_LENGTH<float, M2>(out_channels - oc);
+						for (int ic = 0; ic < ic_group; ++ic) {
+							const float* in_chan_ptr = in_batch_base + ic * in_area;
+							const float* w_ic_base = &w_group[(ic * kernel_spatial) * oc_group + oc];
 
-			for (int oh = 0; oh < out_h; ++oh) {
-				int ih_base = oh * stride_h - pad_h;
-				for (int ow = 0; ow < out_w; ++ow) {
-					
-					int iw_base = ow * stride_w - pad_w;
-					float* out_ptr = out_batch_base + oc * out_area + oh * out_w + ow;
-					
-					// Load current output (0.0)
-					vfloat32m2_t v_acc = VECTOR_STRIDED_LOAD<float, M2>(out_ptr, out_area * sizeof(float), vl);
-
-					for (int ic = 0; ic < in_channels; ++ic) {
-						const float* in_chan_ptr = in_batch_base + ic * in_area;
-						const float* w_ic_base = &packed_w[(ic * kernel_spatial) * out_channels + oc];
-
-						for (int kh = 0; kh < kernel_h; ++kh) {
-							int ih = ih_base + kh;
-							if (ih < 0 || ih >= input_h) continue;
-
-							for (int kw = 0; kw < kernel_w; ++kw) {
-								int iw = iw_base + kw;
-								if (iw < 0 || iw >= input_w) continue;
-
-								float scalar_in = in_chan_ptr[ih * input_w + iw];
-								
-								// UNIT-STRIDE LOAD: This is the speed boost
-								const float* w_ptr = w_ic_base + (kh * kernel_w + kw) * out_channels;
-								vfloat32m2_t v_weight = VECTOR_LOAD<float, M2>(w_ptr, vl);
-
-								v_acc = VECTOR_FMACC_VF<float, M2>(v_acc, scalar_in, v_weight, vl);
+							for (int kh = 0; kh < kernel_h; ++kh) {
+								int ih = ih_base + kh * dilation_h;
+								if (ih < 0 || ih >= input_h) continue;
+
+								for (int kw = 0; kw < kernel_w; ++kw) {
+									int iw = iw_base + kw * dilation_w;
+									if (iw < 0 || iw >= input_w) continue;
+
+									float scalar_in = in_chan_ptr[ih * input_w + iw];
+
+									// Unit-stride load of vl output channels' weights
+									auto v_w = VECTOR_LOAD<float, LMUL>(w_ic_base + (kh * kernel_w + kw) * oc_group, vl);
+									v_acc = VECTOR_FMACC_VF<float, LMUL>(v_acc, scalar_in, v_w, vl);
+								}
 							}
 						}
+						// Store back to NCHW (one element per output channel plane)
+						VECTOR_STRIDED_STORE<float, LMUL>(out_ptr, out_area * sizeof(float), v_acc, vl);
 					}
-					// Final Store back to NCHW
-					VECTOR_STRIDED_STORE<float, M2>(out_ptr, out_area * sizeof(float), v_acc, vl);
 				}
+				oc += vl;
 			}
-			oc += vl;
 		}
 	}
 }
 
+// Unpacked entry points: pack into a call-local buffer, then run the prepacked kernel
+template<int LMUL>
+static void conv2d_direct(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w,
+	int dilation_h = 1, int dilation_w = 1, int group = 1) {
 
-void conv2d_e32m4(
+	int ic_group = in_channels / group;
+	int oc_group = out_channels / group;
+	int group_size = ic_group * kernel_h * kernel_w * oc_group;
+
+	std::vector<float> packed_w(static_cast<size_t>(group) * group_size);
+	for (int g = 0; g < group; ++g) {
+		pack_conv_weights_ihwo(kernel + g * group_size, packed_w.data() + g * group_size,
+			ic_group, oc_group, kernel_h * kernel_w);
+	}
+
+	conv2d_direct_packed<LMUL>(input, packed_w.data(), output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w,
+		dilation_h, dilation_w, group);
+}
+
+// RVV optimized 2D convolution (e32m1)
+void conv2d_e32m1(
 	const float* input, const float* kernel, float* output,
 	int batch_size, int in_channels, int out_channels,
 	int input_h, int input_w, int kernel_h, int kernel_w,
 	int stride_h, int stride_w, int pad_h, int pad_w) {
-	
-	int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
-	int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
-	int out_area = out_h * out_w;
-	int in_area = input_h * input_w;
-	int kernel_spatial = kernel_h * kernel_w;
 
-	// Weight packing logic remains identical to M1...
-	for (int ic = 0; ic < in_channels; ++ic) {
-		for (int k = 0; k < kernel_spatial; ++k) {
-			for (int oc = 0; oc < out_channels; ++oc) {
-				packed_w[(ic * kernel_spatial + k) * out_channels + oc] = 
-					kernel[oc * (in_channels * kernel_spatial) + ic * kernel_spatial + k];
-			}
-		}
-	}
+	conv2d_direct<M1>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
 
-	std::memset(output, 0, batch_size * out_channels * out_area * sizeof(float));
+void conv2d_e32m2(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
 
-	for (int b = 0; b < batch_size; ++b) {
-		for (int oc = 0; oc < out_channels; ) {
-			size_t vl = SET_VECTOR_LENGTH<float, M4>(out_channels - oc);
-			for (int oh = 0; oh < out_h; ++oh) {
-				int ih_base = oh * stride_h - pad_h;
-				for (int ow = 0; ow < out_w; ++ow) {
-					int iw_base = ow * stride_w - pad_w;
-					float* out_ptr = &output[b * out_channels * out_area + oc * out_area + oh * out_w + ow];
-					
-					vfloat32m4_t v_acc = VECTOR_STRIDED_LOAD<float, M4>(out_ptr, out_area * sizeof(float), vl);
-
-					for (int ic = 0; ic < in_channels; ++ic) {
-						const float* w_ic_base = &packed_w[(ic * kernel_spatial) * out_channels + oc];
-						for (int kh = 0; kh < kernel_h; ++kh) {
-							int ih = ih_base + kh;
-							if (ih < 0 || ih >= input_h) continue;
-							for (int kw = 0; kw < kernel_w; ++kw) {
-								int iw = iw_base + kw;
-								if (iw < 0 || iw >= input_w) continue;
-								float scalar_in = input[b * in_channels * in_area + ic * in_area + ih * input_w + iw];
-								vfloat32m4_t v_w = VECTOR_LOAD<float, M4>(w_ic_base + (kh * kernel_w + kw) * out_channels, vl);
-								v_acc = VECTOR_FMACC_VF<float, M4>(v_acc, scalar_in, v_w, vl);
-							}
-						}
-					}
-					VECTOR_STRIDED_STORE<float, M4>(out_ptr, out_area * sizeof(float), v_acc, vl);
-				}
-			}
-			oc += vl;
-		}
-	}
+	conv2d_direct<M2>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_e32m4(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	conv2d_direct<M4>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
 }
 
 void conv2d_e32m8(
@@ -298,56 +280,96 @@ void conv2d_e32m8(
 	int batch_size, int in_channels, int out_channels,
 	int input_h, int input_w, int kernel_h, int kernel_w,
 	int stride_h, int stride_w, int pad_h, int pad_w) {
-	
-	int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
-	int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
-	int out_area = out_h * out_w;
-	int in_area = input_h * input_w;
-	int kernel_spatial = kernel_h * kernel_w;
 
-	// Weight packing logic...
-	for (int ic = 0; ic < in_channels; ++ic) {
-		for (int k = 0; k < kernel_spatial; ++k) {
-			for (int oc = 0; oc < out_channels; ++oc) {
-				packed_w[(ic * kernel_spatial + k) * out_channels + oc] = 
-					kernel[oc * (in_channels * kernel_spatial) + ic * kernel_spatial + k];
-			}
-		}
-	}
+	conv2d_direct<M8>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
 
-	std::memset(output, 0, batch_size * out_channels * out_area * sizeof(float));
+// Grouped / dilated forms: kernel is [out_channels][in_channels / group][kH][kW] and tap
+// (kh, kw) reads input (oh * stride_h - pad_h + kh * dilation_h, ...), as ONNX Conv
+void conv2d_grouped_e32m1(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w,
+	int dilation_h, int dilation_w, int group) {
 
-	for (int b = 0; b < batch_size; ++b) {
-		for (int oc = 0; oc < out_channels; ) {
-			size_t vl = SET_VECTOR_LENGTH<float, M8>(out_channels - oc);
-			for (int oh = 0; oh < out_h; ++oh) {
-				int ih_base = oh * stride_h - pad_h;
-				for (int ow = 0; ow < out_w; ++ow) {
-					int iw_base = ow * stride_w - pad_w;
-					float* out_ptr = &output[b * out_channels * out_area + oc * out_area + oh * out_w + ow];
-					
-					vfloat32m8_t v_acc = VECTOR_STRIDED_LOAD<float, M8>(out_ptr, out_area * sizeof(float), vl);
-
-					for (int ic = 0; ic < in_channels; ++ic) {
-						const float* w_ic_base = &packed_w[(ic * kernel_spatial) * out_channels + oc];
-						for (int kh = 0; kh < kernel_h; ++kh) {
-							int ih = ih_base + kh;
-							if (ih < 0 || ih >= input_h) continue;
-							for (int kw = 0; kw < kernel_w; ++kw) {
-								int iw = iw_base + kw;
-								if (iw < 0 || iw >= input_w) continue;
-								float scalar_in = input[b * in_channels * in_area + ic * in_area + ih * input_w + iw];
-								vfloat32m8_t v_w = VECTOR_LOAD<float, M8>(w_ic_base + (kh * kernel_w + kw) * out_channels, vl);
-								v_acc = VECTOR_FMACC_VF<float, M8>(v_acc, scalar_in, v_w, vl);
-							}
-						}
-					}
-					VECTOR_STRIDED_STORE<float, M8>(out_ptr, out_area * sizeof(float), v_acc, vl);
-				}
-			}
-			oc += vl;
-		}
-	}
+	conv2d_direct<M1>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w,
+		dilation_h, dilation_w, group);
+}
+
+void conv2d_grouped_e32m2(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w,
+	int dilation_h, int dilation_w, int group) {
+
+	conv2d_direct<M2>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w,
+		dilation_h, dilation_w, group);
+}
+
+void conv2d_grouped_e32m4(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w,
+	int dilation_h, int dilation_w, int group) {
+
+	conv2d_direct<M4>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w,
+		dilation_h, dilation_w, group);
+}
+
+void conv2d_grouped_e32m8(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w,
+	int dilation_h, int dilation_w, int group) {
+
+	conv2d_direct<M8>(input, kernel, output, batch_size, in_channels, out_channels,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w,
+		dilation_h, dilation_w, group);
+}
+
+// Prepacked entry points: the layer shape comes from the handle
+void conv2d_e32m1_prepacked(
+	const float* input, const PackedConvWeights* w, float* output,
+	int batch_size, int input_h, int input_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	conv2d_direct_packed<M1>(input, w->data.data(), output, batch_size, w->in_channels, w->out_channels,
+		input_h, input_w, w->kernel_h, w->kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_e32m2_prepacked(
+	const float* input, const PackedConvWeights* w, float* output,
+	int batch_size, int input_h, int input_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	conv2d_direct_packed<M2>(input, w->data.data(), output, batch_size, w->in_channels, w->out_channels,
+		input_h, input_w, w->kernel_h, w->kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_e32m4_prepacked(
+	const float* input, const PackedConvWeights* w, float* output,
+	int batch_size, int input_h, int input_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	conv2d_direct_packed<M4>(input, w->data.data(), output, batch_size, w->in_channels, w->out_channels,
+		input_h, input_w, w->kernel_h, w->kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_e32m8_prepacked(
+	const float* input, const PackedConvWeights* w, float* output,
+	int batch_size, int input_h, int input_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	conv2d_direct_packed<M8>(input, w->data.data(), output, batch_size, w->in_channels, w->out_channels,
+		input_h, input_w, w->kernel_h, w->kernel_w, stride_h, stride_w, pad_h, pad_w);
 }
 
 /********************************* ARA-Specific im2col-gemm Vectorized Versions*********************************/
@@ -455,7 +477,7 @@ void conv2d_im2col_gemm_scalar(
 void conv2d_im2col_gemm_vector(
     const float* input, const float* weights, const float* bias,
     float* output,
-    float* col_buf, float* gemm_buf,
+    float* col_buf,
     int C, int H, int W, int M, int KH, int KW,
     int pad_h, int pad_w, int stride_h, int stride_w,
     int has_bias
@@ -468,30 +490,20 @@ void conv2d_im2col_gemm_vector(
     int K = C * KH * KW;
     int N = out_h * out_w;
 
-    gemm_blocked_e32m8(weights, col_buf, gemm_buf, M, N, K, 32, 128, 32);
-
-    // Vectorized Bias Add
-    size_t vl;
-    for (int m = 0; m < M; ++m) {
-        float b_val = has_bias ? bias[m] : 0.0f;
-        float* out_ptr = &output[m * N];
-        float* gem_ptr = &gemm_buf[m * N];
-        size_t n = 0;
-        while (n < N) {
-            vl = SET_VECTOR_LENGTH<float, M8>(N - n);
-            vfloat32m8_t v_data = VECTOR_LOAD<float, M8>(&gem_ptr[n], vl);
-            vfloat32m8_t v_res = VECTOR_ADD_VX<float, M8>(v_data, b_val, vl);
-            VECTOR_STORE<float, M8>(&out_ptr[n], v_res, vl);
-            n += vl;
-        }
-    }
+    // Bias is fused into the GEMM store
+    GemmEpilogue<float> ep;
+    ep.bias = bias;
+    gemm_packed_strided_ep<float, M8>(has_bias ? GEMM_EP_BIAS : GEMM_EP_NONE, M, N, K,
+                                      weights, K, 1, col_buf, N, 1, output, N, ep);
 }
 
 // =========================================================
 // PART 3: FULLY VECTORIZED
 // =========================================================
 
-void im2col_e32m8(
+// Im2col of output rows [oh_first, oh_last) only: data_col is K x ((oh_last - oh_first) * out_w).
+// Row (c, kh, kw) reads input row oh * stride_h - pad_h + kh * dilation_h.
+static void im2col_rows_e32m8(
     const float* data_im,
     float* data_col,
     int channels,
@@ -502,209 +514,808 @@ void im2col_e32m8(
     int pad_h,
     int pad_w,
     int stride_h,
-    int stride_w)
+    int stride_w,
+    int dilation_h,
+    int dilation_w,
+    int oh_first,
+    int oh_last)
 {
-    const int out_height =
-        (height + 2 * pad_h - kernel_h) / stride_h + 1;
     const int out_width =
-        (width + 2 * pad_w - kernel_w) / stride_w + 1;
-    const int out_area = out_height * out_width;
+        (width + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1;
+    const int out_area = (oh_last - oh_first) * out_width;
+
+    // Zero-fill dst[0 .. n)
+    auto zero_fill = [](float* dst, int n) {
+        for (int i = 0; i < n; ) {
+            size_t vl = SET_VECTOR_LENGTH<float, M8>(n - i);
+            VECTOR_STORE<float, M8>(dst + i, VECTOR_BROADCAST<float, M8>(0.0f, vl), vl);
+            i += vl;
+        }
+    };
 
-    for (int c = 0; c < channels; ++c) {
-        const float* im_c = data_im + c * height * width;
+    for (int kw = 0; kw < kernel_w; ++kw) {
+        // Output columns [ow_lo, ow_hi) read inside the image for this kw, whatever the
+        // row: 0 <= ow * stride_w + iw_off < width. Left of it is left padding, right of it
+        // right padding, so every row is zeros + one contiguous (or strided) load + zeros.
+        const int iw_off = kw * dilation_w - pad_w;
+        int ow_lo = iw_off >= 0 ? 0 : (-iw_off + stride_w - 1) / stride_w;
+        int ow_hi = iw_off > width - 1 ? 0 : std::min(out_width, (width - 1 - iw_off) / stride_w + 1);
+        ow_lo = std::min(ow_lo, ow_hi);
 
-        for (int kh = 0; kh < kernel_h; ++kh) {
-            for (int kw = 0; kw < kernel_w; ++kw) {
+        for (int c = 0; c < channels; ++c) {
+            const float* im_c = data_im + c * height * width;
 
+            for (int kh = 0; kh < kernel_h; ++kh) {
                 const int col_row =
                     (c * kernel_h * kernel_w) + (kh * kernel_w + kw);
                 float* col_ptr = data_col + col_row * out_area;
 
-                for (int oh = 0; oh < out_height; ++oh) {
-                    const int ih = oh * stride_h - pad_h + kh;
-                    float* dst = col_ptr + oh * out_width;
+                for (int oh = oh_first; oh < oh_last; ++oh) {
+                    const int ih = oh * stride_h - pad_h + kh * dilation_h;
+                    float* dst = col_ptr + (oh - oh_first) * out_width;
 
                     // If height is out of bounds → whole row is zero
                     if (ih < 0 || ih >= height) {
-                        int ow = 0;
-                        while (ow < out_width) {
-                            size_t vl =
-                                SET_VECTOR_LENGTH<float, M8>(out_width - ow);
-                            vfloat32m8_t vz =
-                                VECTOR_BROADCAST<float, M8>(0.0f, vl);
-                            VECTOR_STORE<float, M8>(dst + ow, vz, vl);
-                            ow += vl;
-                        }
+                        zero_fill(dst, out_width);
                         continue;
                     }
 
-                    // Height valid → check width per element
-                    const float* im_row = im_c + ih * width;
-
-                    int ow = 0;
-                    while (ow < out_width) {
-                        size_t vl =
-                            SET_VECTOR_LENGTH<float, M8>(out_width - ow);
-
-                        int iw0 = ow * stride_w - pad_w + kw;
-
-                        // ---------- FAST PATH ----------
-                        if (stride_w == 1 &&
-                            iw0 >= 0 &&
-                            iw0 + (int)vl <= width) {
-
-                            const float* src = im_row + iw0;
-                            vfloat32m8_t v =
-                                VECTOR_LOAD<float, M8>(src, vl);
+                    const float* src = im_c + ih * width + ow_lo * stride_w + iw_off;
+                    zero_fill(dst, ow_lo);
+                    for (int ow = ow_lo; ow < ow_hi; ) {
+                        size_t vl = SET_VECTOR_LENGTH<float, M8>(ow_hi - ow);
+                        if (stride_w == 1) {
+                            VECTOR_STORE<float, M8>(dst + ow, VECTOR_LOAD<float, M8>(src, vl), vl);
+                        } else {
+                            vfloat32m8_t v = VECTOR_STRIDED_LOAD<float, M8>(src, stride_w * sizeof(float), vl);
                             VECTOR_STORE<float, M8>(dst + ow, v, vl);
                         }
-                        // ---------- SAFE PATH ----------
-                        else {
-                            float tmp[256]; // enough for any RVV VL
-
-                            for (size_t i = 0; i < vl; ++i) {
-                                int iw = iw0 + (int)i * stride_w;
-                                if (iw >= 0 && iw < width) {
-                                    tmp[i] = im_row[iw];
-                                } else {
-                                    tmp[i] = 0.0f;
-                                }
-                            }
-
-                            vfloat32m8_t v =
-                                VECTOR_LOAD<float, M8>(tmp, vl);
-                            VECTOR_STORE<float, M8>(dst + ow, v, vl);
-                        }
-
+                        src += vl * stride_w;
                         ow += vl;
                     }
+                    zero_fill(dst + ow_hi, out_width - ow_hi);
                 }
             }
         }
     }
 }
 
+// Im2col with dilated taps (all output rows)
+void im2col_dilated_e32m8(
+    const float* data_im,
+    float* data_col,
+    int channels,
+    int height,
+    int width,
+    int kernel_h,
+    int kernel_w,
+    int pad_h,
+    int pad_w,
+    int stride_h,
+    int stride_w,
+    int dilation_h,
+    int dilation_w)
+{
+    const int out_height =
+        (height + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1;
+
+    im2col_rows_e32m8(data_im, data_col, channels, height, width,
+                      kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w,
+                      dilation_h, dilation_w, 0, out_height);
+}
+
+void im2col_e32m8(
+    const float* data_im,
+    float* data_col,
+    int channels,
+    int height,
+    int width,
+    int kernel_h,
+    int kernel_w,
+    int pad_h,
+    int pad_w,
+    int stride_h,
+    int stride_w)
+{
+    im2col_dilated_e32m8(data_im, data_col, channels, height, width,
+                         kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, 1, 1);
+}
+
 void conv2d_im2col_gemm_m8(
     const float* input, const float* kernel, const float* bias,
     float* output,
-    float* col_buf, float* gemm_buf,
+    float* col_buf,
     int in_channels, int input_h, int input_w, 
     int out_channels, int kernel_h, int kernel_w,
     int pad_h, int pad_w, int stride_h, int stride_w,
     int has_bias) {
 
+    conv2d_im2col_gemm_grouped_m8(input, kernel, bias, output, col_buf,
+                                  in_channels, input_h, input_w,
+                                  out_channels, kernel_h, kernel_w,
+                                  pad_h, pad_w, stride_h, stride_w,
+                                  1, 1, 1, has_bias);
+}
+
+// Grouped / dilated im2col + GEMM. col_buf holds the full (in_channels * kH * kW) x N col
+// matrix; its rows for group g are contiguous, so the groups are a strided batch of
+// [M / group x K / group] * [K / group x N] GEMMs.
+void conv2d_im2col_gemm_grouped_m8(
+    const float* input, const float* kernel, const float* bias,
+    float* output,
+    float* col_buf,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int dilation_h, int dilation_w, int group,
+    int has_bias) {
+
     // 1. Setup Dimensions
-    int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
-    int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
-    
-    // GEMM Dimensions
-    int M = out_channels;
-    int K = in_channels * kernel_h * kernel_w;
+    int out_h = (input_h + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1;
+    int out_w = (input_w + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1;
+
+    // GEMM Dimensions (per group)
+    int M = out_channels / group;
+    int K = in_channels / group * kernel_h * kernel_w;
     int N = out_h * out_w;
-    
-    // 2. Vectorized Im2Col (M8)
-    // We use the external col_buf provided by main()
-    im2col_e32m8(input, col_buf,
-                 in_channels, input_h, input_w, 
-                 kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w);
 
-    // 3. Blocked GEMM (M8)
-    // Results go into gemm_buf first (to handle scaling/bias later) or directly to output
-    // Since we need to add bias, let's write to gemm_buf first.
-    // Note: Tuning the block sizes (BM=4, BN=16, BK=32) is key for performance.
-    // You can try (32, 32, 32) or (8, 64, 16) depending on the exact Ara config.
-    gemm_blocked_e32m8(kernel, col_buf, gemm_buf, M, N, K, 8, 64, 32); 
+    // 2. Vectorized Im2Col (M8)
+    // We use the external col_buf provided by main(). A 1x1 stride-1 unpadded col matrix
+    // is the input itself, so it is used as B directly and col_buf is left untouched.
+    const float* col = input;
+    if (!(kernel_h == 1 && kernel_w == 1 && stride_h == 1 && stride_w == 1 && pad_h == 0 && pad_w == 0)) {
+        im2col_dilated_e32m8(input, col_buf,
+                             in_channels, input_h, input_w,
+                             kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w,
+                             dilation_h, dilation_w);
+        col = col_buf;
+    }
 
-    // 4. Vectorized Bias Add (M8) & Store to Output
-    // If has_bias is 0, this essentially just copies gemm_buf to output
-    for (int m = 0; m < M; ++m) {
-        float b_val = has_bias ? bias[m] : 0.0f;
-        
-        float* src_ptr = &gemm_buf[m * N];
-        float* dst_ptr = &output[m * N];
-        
-        size_t n = 0;
-        while (n < N) {
-            size_t vl = SET_VECTOR_LENGTH<float, M8>(N - n);
-            
-            vfloat32m8_t v_data = VECTOR_LOAD<float, M8>(&src_ptr[n], vl);
-            
-            // Only add bias if it exists, otherwise just move data
-            if (has_bias) {
-                v_data = VECTOR_ADD<float, M8>(v_data, b_val, vl);
-            }
-            
-            VECTOR_STORE<float, M8>(&dst_ptr[n], v_data, vl);
-            n += vl;
-        }
+    // 3. Packed-panel GEMM (M8) with the bias fused into the store, straight into output.
+    // Cache blocking (GEMM_MC / GEMM_KC / GEMM_NC) is tuned in lib/rvv_gemm.hpp.
+    if (group == 1) {
+        GemmEpilogue<float> ep;
+        ep.bias = bias;
+        gemm_packed_strided_ep<float, M8>(has_bias ? GEMM_EP_BIAS : GEMM_EP_NONE, M, N, K,
+                                          kernel, K, 1, col, N, 1, output, N, ep);
+        return;
     }
-}
 
-void gemm_blocked_e32m8(const float* A, const float* B, float* C,
-                        int M, int N, int K,
-                        int BM, int BN, int BK) {
-    std::memset(C, 0, M * N * sizeof(float));
-    for (int i0 = 0; i0 < M; i0 += BM) {
-        int i_max = MIN(M, i0 + BM);
-        for (int k0 = 0; k0 < K; k0 += BK) {
-            int k_max = MIN(K, k0 + BK);
-            for (int j0 = 0; j0 < N; j0 += BN) {
-                int j_max = MIN(N, j0 + BN);
-                for (int i = i0; i < i_max; ++i) {
-                    float* c_row_ptr = &C[i * N + j0];
-                    size_t j = 0;
-                    size_t current_bn = j_max - j0;
-                    while (j < current_bn) {
-                        size_t vl = SET_VECTOR_LENGTH<float, M8>(current_bn - j);
-                        vfloat32m8_t v_acc = VECTOR_LOAD<float, M8>(&c_row_ptr[j], vl);
-                        for (int k = k0; k < k_max; ++k) {
-                            float a_val = A[i * K + k];
-                            const float* b_row_ptr = &B[k * N + j0 + j];
-                            vfloat32m8_t v_b = VECTOR_LOAD<float, M8>(b_row_ptr, vl);
-                            v_acc = VECTOR_FMACC_VF<float, M8>(v_acc, a_val, v_b, vl);
-                        }
-                        VECTOR_STORE<float, M8>(&c_row_ptr[j], v_acc, vl);
-                        j += vl;
-                    }
-                }
+    // Grouped: the batched GEMM has no epilogue, so the bias is broadcast into the output
+    // first and the products accumulated onto it
+    if (has_bias) {
+        for (int m = 0; m < out_channels; ++m) {
+            float* out_row = output + m * N;
+            for (int n = 0; n < N; ) {
+                size_t vl = SET_VECTOR_LENGTH<float, M8>(N - n);
+                VECTOR_STORE<float, M8>(out_row + n, VECTOR_BROADCAST<float, M8>(bias[m], vl), vl);
+                n += vl;
             }
         }
     }
+    gemm_strided_batched<float, M8>(group, M, N, K,
+                                    kernel, K, 1, M * K,
+                                    col, N, 1, K * N,
+                                    output, N, M * N, has_bias != 0);
 }
 
-void conv2d(
-    const float* input, float* output, const float* weights,
-    int batch,
-    int in_channels, int in_height, int in_width,
-    int out_channels,
-    int kernel_h, int kernel_w,
-    int stride_h, int stride_w,
-    int pad_h, int pad_w)
-{
-    int out_h = (in_height + 2 * pad_h - kernel_h) / stride_h + 1;
-    int out_w = (in_width  + 2 * pad_w - kernel_w) / stride_w + 1;
-
-    int K = in_channels * kernel_h * kernel_w;
-    int N = out_h * out_w;
+// Row-streamed im2col + GEMM: the col matrix is built for a band of output rows at a time
+// and multiplied straight into those output columns, so the workspace is one band of at
+// most CONV_IM2COL_WORKSPACE floats (K x band_rows * out_w) whatever the image size. The
+// band is at least one output row, so deep layers run many narrow bands: the kernel is
+// packed once (GemmPackedA) and reused by every band instead of repacked per GEMM.
+// A 1x1 stride-1 unpadded conv needs no col matrix and runs as one GEMM on the input.
+// Opt-in only: no model calls it, it is for callers that cannot afford the full col_buf.
+#ifndef CONV_IM2COL_WORKSPACE
+#define CONV_IM2COL_WORKSPACE (64 * 1024)
+#endif
 
-    float* col_buf  = new float[K * N];
-    float* gemm_buf = new float[out_channels * N];
+void conv2d_im2col_gemm_streamed_m8(
+    const float* input, const float* kernel, const float* bias,
+    float* output,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int dilation_h, int dilation_w,
+    int has_bias) {
+
+    int out_h = (input_h + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1;
+    int out_w = (input_w + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1;
+    int M = out_channels;
+    int K = in_channels * kernel_h * kernel_w;
+    int N = out_h * out_w;
+    if (out_h <= 0 || out_w <= 0) return;
+
+    GemmEpilogue<float> ep;
+    ep.bias = bias;
+
+    if (kernel_h == 1 && kernel_w == 1 && stride_h == 1 && stride_w == 1 && pad_h == 0 && pad_w == 0) {
+        gemm_packed_strided_ep<float, M8>(has_bias ? GEMM_EP_BIAS : GEMM_EP_NONE, M, N, K,
+                                          kernel, K, 1, input, N, 1, output, N, ep);
+        return;
+    }
+
+    int band_rows = std::max(1, std::min(out_h, (int)(CONV_IM2COL_WORKSPACE / ((size_t)K * out_w))));
+    std::vector<float> col_band((size_t)K * band_rows * out_w);
+
+    GemmPackedA<float, M8> pa;
+    gemm_prepack_a<float, M8>(M, K, kernel, K, 1, pa);
+
+    for (int oh0 = 0; oh0 < out_h; oh0 += band_rows) {
+        int rows = std::min(band_rows, out_h - oh0);
+        int nb = rows * out_w;
+
+        im2col_rows_e32m8(input, col_band.data(),
+                          in_channels, input_h, input_w,
+                          kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w,
+                          dilation_h, dilation_w, oh0, oh0 + rows);
+
+        if (has_bias)
+            gemm_prepacked_a<float, M8, GEMM_EP_BIAS>(pa, nb, col_band.data(), nb, 1,
+                                                     output + oh0 * out_w, N, false, &ep);
+        else
+            gemm_prepacked_a<float, M8>(pa, nb, col_band.data(), nb, 1, output + oh0 * out_w, N);
+    }
+}
+
+// Epilogue of the fused convolutions. A scale without a shift is taken as shift 0 and a
+// shift without a scale as scale 1; the missing vector is built in `fill`.
+static unsigned conv_fused_epilogue(GemmEpilogue<float>& ep, std::vector<float>& fill, int out_channels,
+    const float* bias, const float* scale, const float* shift, const float* residual, size_t ld_residual,
+    int activation, float alpha, float clip_min, float clip_max) {
+
+    ep.bias = bias;
+    ep.scale = scale;
+    ep.shift = shift;
+    ep.residual = residual;
+    ep.ld_residual = ld_residual;
+    ep.alpha = alpha;
+    ep.clip_min = clip_min;
+    ep.clip_max = clip_max;
+
+    if (scale && !shift) {
+        fill.assign(out_channels, 0.0f);
+        ep.shift = fill.data();
+    } else if (shift && !scale) {
+        fill.assign(out_channels, 1.0f);
+        ep.scale = fill.data();
+    }
+
+    unsigned ops = GEMM_EP_NONE;
+    if (bias) ops |= GEMM_EP_BIAS;
+    if (scale || shift) ops |= GEMM_EP_SCALE_SHIFT;
+    if (residual) ops |= GEMM_EP_RESIDUAL;
+    if (activation == CONV_ACT_RELU) ops |= GEMM_EP_RELU;
+    else if (activation == CONV_ACT_LEAKY_RELU) ops |= GEMM_EP_LEAKY_RELU;
+    else if (activation == CONV_ACT_CLIP) ops |= GEMM_EP_CLIP;
+    return ops;
+}
+
+// Im2col + GEMM with the layer's elementwise tail applied to the accumulators before
+// they are stored, so the output is written once. Per output channel m:
+//   y = conv + bias[m]                  (bias != nullptr)
+//   y = y * scale[m] + shift[m]         (scale / shift != nullptr: folded batch norm;
+//                                        a null shift is 0, a null scale is 1)
+//   y = y + residual[m][n]              (residual != nullptr, same layout as output)
+//   y = act(y)                          (CONV_ACT_*, alpha = LeakyReLU slope)
+void conv2d_im2col_gemm_fused_m8(
+    const float* input, const float* kernel,
+    const float* bias, const float* scale, const float* shift, const float* residual,
+    float* output, float* col_buf,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int activation, float alpha, float clip_min, float clip_max) {
+
+    int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
+    int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
+
+    int M = out_channels;
+    int K = in_channels * kernel_h * kernel_w;
+    int N = out_h * out_w;
+
+    im2col_e32m8(input, col_buf,
+                 in_channels, input_h, input_w,
+                 kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w);
+
+    GemmEpilogue<float> ep;
+    std::vector<float> fill;
+    unsigned ops = conv_fused_epilogue(ep, fill, out_channels, bias, scale, shift, residual, N,
+                                       activation, alpha, clip_min, clip_max);
+
+    gemm_packed_strided_ep<float, M8>(ops, M, N, K, kernel, K, 1, col_buf, N, 1, output, N, ep);
+}
+
+// =========================================================
+// PART 4: IMPLICIT GEMM (no col buffer)
+// =========================================================
+// Same GEMM as conv2d_im2col_gemm_m8, but the col matrix is gathered from the input while
+// the B panels are packed (lib/rvv_conv_gemm.hpp): memory stays at one KC x NC panel block
+// instead of K x N floats, and the output matches the im2col path.
+void conv2d_implicit_gemm_m8(
+    const float* input, const float* kernel, const float* bias,
+    float* output,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int has_bias) {
+
+    ConvGemmShape s = {(size_t)in_channels, (size_t)input_h, (size_t)input_w,
+                       (size_t)kernel_h, (size_t)kernel_w,
+                       (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w};
+
+    GemmEpilogue<float> ep;
+    ep.bias = bias;
+    conv2d_implicit_gemm_ep<float, M8>(has_bias ? GEMM_EP_BIAS : GEMM_EP_NONE,
+                                       input, kernel, output, s, out_channels, ep);
+}
+
+// Implicit-GEMM counterpart of conv2d_im2col_gemm_fused_m8 (same epilogue, no col_buf)
+void conv2d_implicit_gemm_fused_m8(
+    const float* input, const float* kernel,
+    const float* bias, const float* scale, const float* shift, const float* residual,
+    float* output,
+    int in_channels, int input_h, int input_w,
+    int out_channels, int kernel_h, int kernel_w,
+    int pad_h, int pad_w, int stride_h, int stride_w,
+    int activation, float alpha, float clip_min, float clip_max) {
+
+    ConvGemmShape s = {(size_t)in_channels, (size_t)input_h, (size_t)input_w,
+                       (size_t)kernel_h, (size_t)kernel_w,
+                       (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w};
+
+    GemmEpilogue<float> ep;
+    std::vector<float> fill;
+    unsigned ops = conv_fused_epilogue(ep, fill, out_channels, bias, scale, shift, residual, s.N(),
+                                       activation, alpha, clip_min, clip_max);
+
+    conv2d_implicit_gemm_ep<float, M8>(ops, input, kernel, output, s, out_channels, ep);
+}
+
+// =========================================================
+// PART 5: WINOGRAD F(2x2, 3x3) / F(4x4, 3x3) (3x3, stride 1)
+// =========================================================
+// lib/rvv_winograd.hpp: vectorized input / output transforms around a batch of a^2 GEMMs.
+// The filter transform is a property of the layer: pack_winograd_weights builds it once.
+
+struct WinogradConvWeights {
+	WinogradFilter f;
+};
+
+static void winograd_check_tile(int tile_m) {
+	if (tile_m != 2 && tile_m != 4)
+		throw std::invalid_argument("Winograd tile_m must be 2 (F(2x2,3x3)) or 4 (F(4x4,3x3))");
+}
+
+WinogradConvWeights* pack_winograd_weights(const float* kernel,
+	int in_channels, int out_channels, int tile_m) {
+
+	winograd_check_tile(tile_m);
+	WinogradConvWeights* w = new WinogradConvWeights;
+	winograd_transform_filter<M8>(tile_m, kernel, out_channels, in_channels, w->f);
+	return w;
+}
+
+void free_winograd_weights(WinogradConvWeights* w) {
+	delete w;
+}
+
+void conv2d_winograd_m8_prepacked(
+	const float* input, const WinogradConvWeights* w, float* output,
+	int batch_size, int input_h, int input_w, int pad_h, int pad_w) {
+
+	int out_h = input_h + 2 * pad_h - 2;
+	int out_w = input_w + 2 * pad_w - 2;
+	size_t in_size = w->f.in_channels * input_h * input_w;
+	size_t out_size = w->f.out_channels * out_h * out_w;
+
+	for (int b = 0; b < batch_size; ++b) {
+		conv2d_winograd<M8>(input + b * in_size, w->f, output + b * out_size,
+			input_h, input_w, pad_h, pad_w);
+	}
+}
+
+// Convenience form: transforms the filters on every call
+void conv2d_winograd_m8(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int pad_h, int pad_w, int tile_m) {
+
+	winograd_check_tile(tile_m);
+	WinogradConvWeights w;
+	winograd_transform_filter<M8>(tile_m, kernel, out_channels, in_channels, w.f);
+	conv2d_winograd_m8_prepacked(input, &w, output, batch_size, input_h, input_w, pad_h, pad_w);
+}
+
+// =========================================================
+// PART 6: BLOCKED NCHW[c] LAYOUT
+// =========================================================
+// lib/rvv_nchwc.hpp: activations stored [C / block][H][W][block], so the channels of one
+// pixel are one unit-stride vector. Convert once at the model boundary; conv, pool, BN,
+// bias and activations then stay blocked. block must fit one register group of the LMUL
+// variant that runs it (4 / 8 / 16 / 32 lanes for m1 / m2 / m4 / m8 at VLEN = 128);
+// a wider block throws std::invalid_argument.
+
+struct NchwcConvWeights {
+	int in_channels, out_channels, kernel_h, kernel_w, block;
+	std::vector<float> data;
+	std::vector<float> bias;    // zero-padded to whole blocks, empty without bias
+};
+
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block) {
+	nchw_to_nchwc<M8>(src, dst, channels, height, width, block);
+}
+
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block) {
+	nchwc_to_nchw<M8>(src, dst, channels, height, width, block);
+}
+
+NchwcConvWeights* pack_nchwc_weights(const float* kernel, const float* bias,
+	int in_channels, int out_channels, int kernel_h, int kernel_w, int block) {
+
+	NchwcConvWeights* w = new NchwcConvWeights{in_channels, out_channels, kernel_h, kernel_w, block, {}, {}};
+	w->data.resize(nchwc_weights_size(out_channels, in_channels, kernel_h, kernel_w, block));
+	nchwc_pack_weights(kernel, w->data.data(), out_channels, in_channels, kernel_h, kernel_w, block);
+	w->bias = nchwc_pad_channels(bias, out_channels, block);
+	return w;
+}
+
+void free_nchwc_weights(NchwcConvWeights* w) {
+	delete w;
+}
+
+template<int LMUL>
+static void conv2d_nchwc_impl(
+	const float* input, const NchwcConvWeights* w, float* output,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	ConvGemmShape s = {(size_t)w->in_channels, (size_t)input_h, (size_t)input_w,
+	                   (size_t)w->kernel_h, (size_t)w->kernel_w,
+	                   (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w};
+
+	if (!w->bias.empty()) {
+		GemmEpilogue<float> ep;
+		ep.bias = w->bias.data();
+		conv2d_nchwc<LMUL, GEMM_EP_BIAS>(input, w->data.data(), output, s, w->out_channels, w->block, &ep);
+	} else {
+		conv2d_nchwc<LMUL>(input, w->data.data(), output, s, w->out_channels, w->block);
+	}
+}
+
+void conv2d_nchwc_e32m1(
+	const float* input, const NchwcConvWeights* w, float* output,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_nchwc_impl<M1>(input, w, output, input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_nchwc_e32m2(
+	const float* input, const NchwcConvWeights* w, float* output,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_nchwc_impl<M2>(input, w, output, input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_nchwc_e32m4(
+	const float* input, const NchwcConvWeights* w, float* output,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_nchwc_impl<M4>(input, w, output, input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_nchwc_e32m8(
+	const float* input, const NchwcConvWeights* w, float* output,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_nchwc_impl<M8>(input, w, output, input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+// =========================================================
+// PART 7: DEPTHWISE (+ FUSED POINTWISE)
+// =========================================================
+// lib/rvv_depthwise.hpp: the row-vector scheme of conv2d_3x3_m8 generalized to any kernel,
+// stride, padding (in the kernel, no padded copy) and channel multiplier. Output channel
+// c * multiplier + j filters input channel c; kernel is [channels * multiplier][kH][kW].
+
+void depthwise_conv2d_scalar(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int channels, int multiplier,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
+	int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
+	int out_channels = channels * multiplier;
+
+	for (int b = 0; b < batch_size; ++b) {
+		for (int oc = 0; oc < out_channels; ++oc) {
+			const float* in_c = input + (b * channels + oc / multiplier) * input_h * input_w;
+			const float* k = kernel + oc * kernel_h * kernel_w;
+			float* out_c = output + (b * out_channels + oc) * out_h * out_w;
+
+			for (int oh = 0; oh < out_h; ++oh) {
+				for (int ow = 0; ow < out_w; ++ow) {
+					float sum = 0.0f;
+					for (int kh = 0; kh < kernel_h; ++kh) {
+						int ih = oh * stride_h + kh - pad_h;
+						if (ih < 0 || ih >= input_h) continue;
+						for (int kw = 0; kw < kernel_w; ++kw) {
+							int iw = ow * stride_w + kw - pad_w;
+							if (iw < 0 || iw >= input_w) continue;
+							sum += in_c[ih * input_w + iw] * k[kh * kernel_w + kw];
+						}
+					}
+					out_c[oh * out_w + ow] = sum;
+				}
+			}
+		}
+	}
+}
+
+template<int LMUL>
+static void depthwise_conv2d_impl(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int channels, int multiplier,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	ConvGemmShape s = {(size_t)channels, (size_t)input_h, (size_t)input_w,
+	                   (size_t)kernel_h, (size_t)kernel_w,
+	                   (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w};
+	size_t in_size = s.in_channels * s.in_h * s.in_w;
+	size_t out_size = s.in_channels * multiplier * s.N();
+
+	for (int b = 0; b < batch_size; ++b) {
+		depthwise_conv2d<LMUL>(input + b * in_size, kernel, output + b * out_size, s, multiplier);
+	}
+}
+
+void depthwise_conv2d_e32m1(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int channels, int multiplier,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+	depthwise_conv2d_impl<M1>(input, kernel, output, batch_size, channels, multiplier,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void depthwise_conv2d_e32m2(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int channels, int multiplier,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+	depthwise_conv2d_impl<M2>(input, kernel, output, batch_size, channels, multiplier,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void depthwise_conv2d_e32m4(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int channels, int multiplier,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+	depthwise_conv2d_impl<M4>(input, kernel, output, batch_size, channels, multiplier,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void depthwise_conv2d_e32m8(
+	const float* input, const float* kernel, float* output,
+	int batch_size, int channels, int multiplier,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w) {
+	depthwise_conv2d_impl<M8>(input, kernel, output, batch_size, channels, multiplier,
+		input_h, input_w, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+template<unsigned ACT>
+static void depthwise_pointwise_impl(
+	const float* input, const float* dw_kernel, const float* pw_kernel, float* output,
+	const ConvGemmShape& s, int multiplier, int out_channels,
+	const GemmEpilogue<float>* ep_dw, const GemmEpilogue<float>* ep_pw) {
+	// A null bias drops GEMM_EP_BIAS from that stage's epilogue
+	if (ep_dw->bias && ep_pw->bias) {
+		depthwise_pointwise_conv2d<M8, GEMM_EP_BIAS | ACT, GEMM_EP_BIAS | ACT>(
+			input, dw_kernel, pw_kernel, output, s, multiplier, out_channels, ep_dw, ep_pw);
+	} else if (ep_dw->bias) {
+		depthwise_pointwise_conv2d<M8, GEMM_EP_BIAS | ACT, ACT>(
+			input, dw_kernel, pw_kernel, output, s, multiplier, out_channels, ep_dw, ep_pw);
+	} else if (ep_pw->bias) {
+		depthwise_pointwise_conv2d<M8, ACT, GEMM_EP_BIAS | ACT>(
+			input, dw_kernel, pw_kernel, output, s, multiplier, out_channels, ep_dw, ep_pw);
+	} else {
+		depthwise_pointwise_conv2d<M8, ACT, ACT>(
+			input, dw_kernel, pw_kernel, output, s, multiplier, out_channels, ep_dw, ep_pw);
+	}
+}
+
+// Depthwise conv -> bias -> activation -> 1x1 conv [out_channels][channels * multiplier]
+// -> bias -> activation, with the depthwise output kept in cache-sized bands of rows.
+// Either bias may be null (no bias add).
+void depthwise_pointwise_conv2d_m8(
+	const float* input, const float* dw_kernel, const float* dw_bias,
+	const float* pw_kernel, const float* pw_bias, float* output,
+	int batch_size, int channels, int multiplier, int out_channels,
+	int input_h, int input_w, int kernel_h, int kernel_w,
+	int stride_h, int stride_w, int pad_h, int pad_w,
+	int activation, float alpha, float clip_min, float clip_max) {
+
+	ConvGemmShape s = {(size_t)channels, (size_t)input_h, (size_t)input_w,
+	                   (size_t)kernel_h, (size_t)kernel_w,
+	                   (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w};
+	size_t in_size = s.in_channels * s.in_h * s.in_w;
+	size_t out_size = (size_t)out_channels * s.N();
+
+	GemmEpilogue<float> ep_dw, ep_pw;
+	ep_dw.bias = dw_bias;
+	ep_pw.bias = pw_bias;
+	ep_dw.alpha = ep_pw.alpha = alpha;
+	ep_dw.clip_min = ep_pw.clip_min = clip_min;
+	ep_dw.clip_max = ep_pw.clip_max = clip_max;
+
+	for (int b = 0; b < batch_size; ++b) {
+		const float* in_b = input + b * in_size;
+		float* out_b = output + b * out_size;
+
+		if (activation == CONV_ACT_RELU) {
+			depthwise_pointwise_impl<GEMM_EP_RELU>(in_b, dw_kernel, pw_kernel, out_b, s, multiplier, out_channels, &ep_dw, &ep_pw);
+		} else if (activation == CONV_ACT_LEAKY_RELU) {
+			depthwise_pointwise_impl<GEMM_EP_LEAKY_RELU>(in_b, dw_kernel, pw_kernel, out_b, s, multiplier, out_channels, &ep_dw, &ep_pw);
+		} else if (activation == CONV_ACT_CLIP) {
+			depthwise_pointwise_impl<GEMM_EP_CLIP>(in_b, dw_kernel, pw_kernel, out_b, s, multiplier, out_channels, &ep_dw, &ep_pw);
+		} else {
+			depthwise_pointwise_impl<GEMM_EP_NONE>(in_b, dw_kernel, pw_kernel, out_b, s, multiplier, out_channels, &ep_dw, &ep_pw);
+		}
+	}
+}
+
+// =========================================================
+// PART 8: MULTI-CHANNEL DIRECT 3x3
+// =========================================================
+// lib/rvv_conv3x3.hpp: the row-vector scheme of conv2d_3x3_m* for a real C_in -> C_out
+// layer. Several output channels accumulate in registers across all input channels, each
+// input tap is loaded once per channel block, and padding is handled in the kernel.
+
+template<int LMUL>
+static void conv2d_3x3_direct_impl(
+	const float* input, const float* kernel, const float* bias, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+
+	ConvGemmShape s = {(size_t)in_channels, (size_t)input_h, (size_t)input_w, 3, 3,
+	                   (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w};
+	size_t in_size = s.in_channels * s.in_h * s.in_w;
+	size_t out_size = (size_t)out_channels * s.N();
+
+	GemmEpilogue<float> ep;
+	ep.bias = bias;
+	for (int b = 0; b < batch_size; ++b) {
+		if (bias) {
+			conv2d_3x3_direct<LMUL, GEMM_EP_BIAS>(input + b * in_size, kernel, output + b * out_size, s, out_channels, &ep);
+		} else {
+			conv2d_3x3_direct<LMUL>(input + b * in_size, kernel, output + b * out_size, s, out_channels);
+		}
+	}
+}
+
+void conv2d_3x3_direct_m1(
+	const float* input, const float* kernel, const float* bias, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_3x3_direct_impl<M1>(input, kernel, bias, output, batch_size, in_channels, out_channels,
+		input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_3x3_direct_m2(
+	const float* input, const float* kernel, const float* bias, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_3x3_direct_impl<M2>(input, kernel, bias, output, batch_size, in_channels, out_channels,
+		input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_3x3_direct_m4(
+	const float* input, const float* kernel, const float* bias, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_3x3_direct_impl<M4>(input, kernel, bias, output, batch_size, in_channels, out_channels,
+		input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d_3x3_direct_m8(
+	const float* input, const float* kernel, const float* bias, float* output,
+	int batch_size, int in_channels, int out_channels,
+	int input_h, int input_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+	conv2d_3x3_direct_impl<M8>(input, kernel, bias, output, batch_size, in_channels, out_channels,
+		input_h, input_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+// Batched convolution: the implicit GEMM per image, with no per-call col buffer.
+// 3x3 stride-1 layers run Winograd through the prepacked overload below, whose filter
+// transform is built once per layer by pack_conv2d_weights (F(4x4) once the output is at
+// least CONV_WINOGRAD_F4_MIN on both sides, F(2x2) below). Build with -DCONV_WINOGRAD=0
+// to keep every layer on the implicit GEMM.
+#ifndef CONV_WINOGRAD
+#define CONV_WINOGRAD 1
+#endif
+
+#ifndef CONV_WINOGRAD_F4_MIN
+#define CONV_WINOGRAD_F4_MIN 16
+#endif
+
+WinogradConvWeights* pack_conv2d_weights(
+    const float* weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels,
+    int kernel_h, int kernel_w,
+    int stride_h, int stride_w,
+    int pad_h, int pad_w)
+{
+    if (!CONV_WINOGRAD || kernel_h != 3 || kernel_w != 3 || stride_h != 1 || stride_w != 1)
+        return nullptr;
+
+    int out_h = in_height + 2 * pad_h - 2;
+    int out_w = in_width + 2 * pad_w - 2;
+    int tile_m = (out_h >= CONV_WINOGRAD_F4_MIN && out_w >= CONV_WINOGRAD_F4_MIN) ? 4 : 2;
+    return pack_winograd_weights(weights, in_channels, out_channels, tile_m);
+}
+
+void conv2d(
+    const float* input, float* output, const float* weights,
+    const WinogradConvWeights* prepacked,
+    int batch,
+    int in_channels, int in_height, int in_width,
+    int out_channels,
+    int kernel_h, int kernel_w,
+    int stride_h, int stride_w,
+    int pad_h, int pad_w)
+{
+    if (prepacked) {
+        conv2d_winograd_m8_prepacked(input, prepacked, output, batch, in_height, in_width, pad_h, pad_w);
+        return;
+    }
+    conv2d(input, output, weights, batch, in_channels, in_height, in_width, out_channels,
+           kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w);
+}
+
+void conv2d(
+    const float* input, float* output, const float* weights,
+    int batch,
+    int in_channels, int in_height, int in_width,
+    int out_channels,
+    int kernel_h, int kernel_w,
+    int stride_h, int stride_w,
+    int pad_h, int pad_w)
+{
+    conv2d_grouped(input, output, weights, batch,
+                   in_channels, in_height, in_width, out_channels,
+                   kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w,
+                   1, 1, 1);
+}
+
+// Grouped / dilated dispatch: group == in_channels is a depthwise conv (lib/rvv_depthwise.hpp),
+// the rest is one implicit GEMM per group.
+void conv2d_grouped(
+    const float* input, float* output, const float* weights,
+    int batch,
+    int in_channels, int in_height, int in_width,
+    int out_channels,
+    int kernel_h, int kernel_w,
+    int stride_h, int stride_w,
+    int pad_h, int pad_w,
+    int dilation_h, int dilation_w, int group)
+{
+    ConvGemmShape s = {(size_t)in_channels, (size_t)in_height, (size_t)in_width,
+                       (size_t)kernel_h, (size_t)kernel_w,
+                       (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w,
+                       (size_t)dilation_h, (size_t)dilation_w};
+    int out_h = (int)s.out_h();
+    int out_w = (int)s.out_w();
 
     for (int n = 0; n < batch; ++n) {
         const float* in_ptr  = input  + n * in_channels * in_height * in_width;
         float* out_ptr = output + n * out_channels * out_h * out_w;
 
-        conv2d_im2col_gemm_m8(
-            in_ptr, weights, nullptr, out_ptr,
-            col_buf, gemm_buf,
-            in_channels, in_height, in_width,
-            out_channels, kernel_h, kernel_w,
-            pad_h, pad_w, stride_h, stride_w,
-            0);
+        if (group > 1 && group == in_channels) {
+            depthwise_conv2d<M8>(in_ptr, weights, out_ptr, s, out_channels / in_channels);
+        } else {
+            conv2d_implicit_gemm_grouped<float, M8>(in_ptr, weights, out_ptr, s, out_channels, group);
+        }
     }
-
-    delete[] col_buf;
-    delete[] gemm_buf;
 }
 
 
@@ -714,21 +1325,113 @@ void conv2d(
 // HELPER FUNCTIONS
 // ============================================================================
 
-// Create zero-padded input (pad=1 for 3x3 kernel)
-float* create_padded_input(const float* input, int H, int W) {
-    int H_pad = H + 2;
-    int W_pad = W + 2;
-    
-    float* padded = (float*)calloc(H_pad * W_pad, sizeof(float));
-    
-    // Copy input to center of padded buffer
-    for (int h = 0; h < H; h++) {
-        memcpy(padded + (h + 1) * W_pad + 1, 
-               input + h * W, 
-               W * sizeof(float));
+// acc += k[0..2] times the three horizontal taps of input row `row` for output columns
+// ow .. ow + vl. v holds row[ow .. ow + vl); the other taps are slid from it, shifting in
+// the neighbouring input element, so each input row is loaded once instead of three times.
+// PAD (zero padding of 1): the taps are columns ow - 1, ow, ow + 1 and the elements left of
+// column 0 / right of column W - 1 shift in as zeros. Otherwise they are ow, ow + 1, ow + 2.
+template<int LMUL, bool PAD, typename VecType>
+static inline VecType conv3x3_row_taps(VecType acc, VecType v, const float* row, int ow, int W,
+                                       const float* k, size_t vl) {
+    if constexpr (PAD) {
+        float left = (ow > 0) ? row[ow - 1] : 0.0f;
+        float right = (ow + (int)vl < W) ? row[ow + vl] : 0.0f;
+        acc = VECTOR_FMACC<float, LMUL>(acc, k[0], VECTOR_SLIDE1UP<float, LMUL>(v, left, vl), vl);
+        acc = VECTOR_FMACC<float, LMUL>(acc, k[1], v, vl);
+        return VECTOR_FMACC<float, LMUL>(acc, k[2], VECTOR_SLIDE1DOWN<float, LMUL>(v, right, vl), vl);
+    } else {
+        acc = VECTOR_FMACC<float, LMUL>(acc, k[0], v, vl);
+        VecType v1 = VECTOR_SLIDE1DOWN<float, LMUL>(v, row[ow + vl], vl);
+        acc = VECTOR_FMACC<float, LMUL>(acc, k[1], v1, vl);
+        VecType v2 = VECTOR_SLIDE1DOWN<float, LMUL>(v1, row[ow + vl + 1], vl);
+        return VECTOR_FMACC<float, LMUL>(acc, k[2], v2, vl);
+    }
+}
+
+// Input row ih, or nullptr if it lies in the zero padding
+static inline const float* conv3x3_input_row(const float* input, int ih, int H, int W) {
+    return (ih >= 0 && ih < H) ? input + ih * W : nullptr;
+}
+
+// Output row by output row: three row loads per output vector. Padding rows are skipped.
+template<int LMUL, bool PAD>
+static void conv3x3_sliding(const float* input, int H, int W, const float* kernel, float* output) {
+    const int out_h = PAD ? H : (H - 2);
+    const int out_w = PAD ? W : (W - 2);
+
+    for (int oh = 0; oh < out_h; oh++) {
+        float* out_row = output + oh * out_w;
+
+        for (int ow = 0; ow < out_w; ) {
+            size_t vl = SET_VECTOR_LENGTH<float, LMUL>(out_w - ow);
+
+            auto acc = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+            for (int kh = 0; kh < 3; kh++) {
+                const float* row = conv3x3_input_row(input, oh + kh - (PAD ? 1 : 0), H, W);
+                if (!row) continue;
+                acc = conv3x3_row_taps<LMUL, PAD>(acc, VECTOR_LOAD<float, LMUL>(row + ow, vl), row, ow, W,
+                                                  kernel + kh * 3, vl);
+            }
+
+            VECTOR_STORE<float, LMUL>(out_row + ow, acc, vl);
+            ow += vl;
+        }
+    }
+}
+
+// Batches of batch_rows output rows, column chunk by column chunk. Down a chunk the three
+// input row vectors rotate (row1 -> row0, row2 -> row1) and only the new bottom row is
+// loaded, one load per output vector. At m8 three row groups and the accumulator already
+// fill the register file, so the rows are reloaded instead of kept.
+template<int LMUL, bool PAD>
+static void conv3x3_sliding_batched(const float* input, int H, int W, const float* kernel,
+                                    float* output, int batch_rows) {
+    constexpr bool rotate = LMUL != M8;
+    constexpr int P = PAD ? 1 : 0;
+    const int out_h = PAD ? H : (H - 2);
+    const int out_w = PAD ? W : (W - 2);
+    if (batch_rows < 1) batch_rows = 1;
+
+    for (int oh_base = 0; oh_base < out_h; oh_base += batch_rows) {
+        int rows_to_process = std::min(batch_rows, out_h - oh_base);
+
+        for (int ow = 0; ow < out_w; ) {
+            size_t vl = SET_VECTOR_LENGTH<float, LMUL>(out_w - ow);
+            const float* row0 = conv3x3_input_row(input, oh_base - P, H, W);
+            const float* row1 = conv3x3_input_row(input, oh_base - P + 1, H, W);
+            auto v_r0 = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+            auto v_r1 = v_r0;
+            if (row0) v_r0 = VECTOR_LOAD<float, LMUL>(row0 + ow, vl);
+            if (row1) v_r1 = VECTOR_LOAD<float, LMUL>(row1 + ow, vl);
+
+            for (int r = 0; r < rows_to_process; r++) {
+                int oh = oh_base + r;
+                if constexpr (!rotate) {
+                    if (r > 0) {
+                        if (row0) v_r0 = VECTOR_LOAD<float, LMUL>(row0 + ow, vl);
+                        if (row1) v_r1 = VECTOR_LOAD<float, LMUL>(row1 + ow, vl);
+                    }
+                }
+                const float* row2 = conv3x3_input_row(input, oh - P + 2, H, W);
+                auto v_r2 = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+                if (row2) v_r2 = VECTOR_LOAD<float, LMUL>(row2 + ow, vl);
+
+                auto acc = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+                if (row0) acc = conv3x3_row_taps<LMUL, PAD>(acc, v_r0, row0, ow, W, kernel, vl);
+                if (row1) acc = conv3x3_row_taps<LMUL, PAD>(acc, v_r1, row1, ow, W, kernel + 3, vl);
+                if (row2) acc = conv3x3_row_taps<LMUL, PAD>(acc, v_r2, row2, ow, W, kernel + 6, vl);
+                VECTOR_STORE<float, LMUL>(output + oh * out_w + ow, acc, vl);
+
+                row0 = row1;
+                row1 = row2;
+                if constexpr (rotate) {
+                    v_r0 = v_r1;
+                    v_r1 = v_r2;
+                }
+            }
+            ow += vl;
+        }
     }
-    
-    return padded;
 }
 
 // ============================================================================
@@ -737,93 +1440,16 @@ float* create_padded_input(const float* input, int H, int W) {
 void conv2d_3x3_m1(
     const float* input, // Input: HxW
     const float* kernel, // Kernel: 3x3 (9 elements, row-major)
-    float* output, // Output: HxW (with padding)
+    float* output, // Output: HxW (with padding) or (H-2)x(W-2)
     int H, // Input height
     int W, // Input width
-    bool use_padding // If true, applies zero-padding
+    bool use_padding // If true, applies zero-padding (in-kernel, no padded copy)
 ) {
-    // Create padded input if needed
-    float* padded_input = nullptr;
-    const float* proc_input = input;
-    int H_proc = H;
-    int W_proc = W;
-   
+    // m1: LMUL=1, ~4 outputs per vector on VLEN=128
     if (use_padding) {
-        padded_input = create_padded_input(input, H, W);
-        proc_input = padded_input;
-        H_proc = H + 2;
-        W_proc = W + 2;
-    }
-   
-    const int out_h = use_padding ? H : (H - 2);
-    const int out_w = use_padding ? W : (W - 2);
-   
-    // Load kernel weights into scalar registers for broadcasting
-    float k00 = kernel[0], k01 = kernel[1], k02 = kernel[2];
-    float k10 = kernel[3], k11 = kernel[4], k12 = kernel[5];
-    float k20 = kernel[6], k21 = kernel[7], k22 = kernel[8];
-   
-    // Process each output row
-    for (int oh = 0; oh < out_h; oh++) {
-        // Get pointers to the 3 input rows needed for this output row
-        const float* row0 = proc_input + oh * W_proc;
-        const float* row1 = row0 + W_proc;
-        const float* row2 = row1 + W_proc;
-        float* out_row = output + oh * out_w;
-       
-        // Vectorized processing across output width with m1
-        int ow = 0;
-        while (ow < out_w) {
-            // Set vector length (m1: LMUL=1, processes ~4 elements on VLEN=128)
-            size_t vl = SET_VECTOR_LENGTH<float, M1>(out_w - ow);
-           
-            // ================================================================
-            // LOAD PHASE: Load 9 vectors (3x3 neighborhood)
-            // ================================================================
-            // Row 0: Load 3 overlapping vectors with offsets 0, 1, 2
-            vfloat32m1_t v00 = VECTOR_LOAD<float, M1>(row0 + ow, vl);
-            vfloat32m1_t v01 = VECTOR_LOAD<float, M1>(row0 + ow + 1, vl);
-            vfloat32m1_t v02 = VECTOR_LOAD<float, M1>(row0 + ow + 2, vl);
-           
-            // Row 1: Load 3 overlapping vectors
-            vfloat32m1_t v10 = VECTOR_LOAD<float, M1>(row1 + ow, vl);
-            vfloat32m1_t v11 = VECTOR_LOAD<float, M1>(row1 + ow + 1, vl);
-            vfloat32m1_t v12 = VECTOR_LOAD<float, M1>(row1 + ow + 2, vl);
-           
-            // Row 2: Load 3 overlapping vectors
-            vfloat32m1_t v20 = VECTOR_LOAD<float, M1>(row2 + ow, vl);
-            vfloat32m1_t v21 = VECTOR_LOAD<float, M1>(row2 + ow + 1, vl);
-            vfloat32m1_t v22 = VECTOR_LOAD<float, M1>(row2 + ow + 2, vl);
-           
-            // ================================================================
-            // COMPUTE PHASE: Fused Multiply-Accumulate (FMA) chain
-            // ================================================================
-            // Start with first multiply
-            vfloat32m1_t acc = VECTOR_MUL<float, M1>(v00, k00, vl);
-           
-            // Chain the remaining 8 FMAs (vector * scalar + accumulator)
-            acc = VECTOR_FMACC<float, M1>(acc, k01, v01, vl);
-            acc = VECTOR_FMACC<float, M1>(acc, k02, v02, vl);
-            acc = VECTOR_FMACC<float, M1>(acc, k10, v10, vl);
-            acc = VECTOR_FMACC<float, M1>(acc, k11, v11, vl);
-            acc = VECTOR_FMACC<float, M1>(acc, k12, v12, vl);
-            acc = VECTOR_FMACC<float, M1>(acc, k20, v20, vl);
-            acc = VECTOR_FMACC<float, M1>(acc, k21, v21, vl);
-            acc = VECTOR_FMACC<float, M1>(acc, k22, v22, vl);
-           
-            // ================================================================
-            // STORE PHASE: Write results
-            // ================================================================
-            VECTOR_STORE<float, M1>(out_row + ow, acc, vl);
-           
-            // Move to next vector chunk
-            ow += vl;
-        }
-    }
-   
-    // Cleanup
-    if (padded_input) {
-        free(padded_input);
+        conv3x3_sliding<M1, true>(input, H, W, kernel, output);
+    } else {
+        conv3x3_sliding<M1, false>(input, H, W, kernel, output);
     }
 }
 // ============================================================================
@@ -835,86 +1461,13 @@ void conv2d_3x3_m2(
     float* output, // Output: HxW (with padding) or (H-2)x(W-2)
     int H, // Input height
     int W, // Input width
-    bool use_padding // If true, applies zero-padding
+    bool use_padding // If true, applies zero-padding (in-kernel, no padded copy)
 ) {
-    // Create padded input if needed
-    float* padded_input = nullptr;
-    const float* proc_input = input;
-    int H_proc = H;
-    int W_proc = W;
-   
+    // m2: LMUL=2, 2x the outputs per vector of m1
     if (use_padding) {
-        padded_input = create_padded_input(input, H, W);
-        proc_input = padded_input;
-        H_proc = H + 2;
-        W_proc = W + 2;
-    }
-   
-    const int out_h = use_padding ? H : (H - 2);
-    const int out_w = use_padding ? W : (W - 2);
-   
-    // Load kernel weights into scalar registers
-    float k00 = kernel[0], k01 = kernel[1], k02 = kernel[2];
-    float k10 = kernel[3], k11 = kernel[4], k12 = kernel[5];
-    float k20 = kernel[6], k21 = kernel[7], k22 = kernel[8];
-   
-    // Process each output row
-    for (int oh = 0; oh < out_h; oh++) {
-        // Get pointers to the 3 input rows needed
-        const float* row0 = proc_input + oh * W_proc;
-        const float* row1 = row0 + W_proc;
-        const float* row2 = row1 + W_proc;
-        float* out_row = output + oh * out_w;
-       
-        // Vectorized processing with m2 (2x throughput vs m1)
-        int ow = 0;
-        while (ow < out_w) {
-            // Set vector length (m2: LMUL=2, processes ~8 elements on VLEN=128)
-            size_t vl = SET_VECTOR_LENGTH<float, M2>(out_w - ow);
-           
-            // ================================================================
-            // LOAD PHASE: Load 9 vectors with m2
-            // ================================================================
-            // Row 0: 3 vectors with offsets 0, 1, 2
-            vfloat32m2_t v00 = VECTOR_LOAD<float, M2>(row0 + ow, vl);
-            vfloat32m2_t v01 = VECTOR_LOAD<float, M2>(row0 + ow + 1, vl);
-            vfloat32m2_t v02 = VECTOR_LOAD<float, M2>(row0 + ow + 2, vl);
-           
-            // Row 1: 3 vectors
-            vfloat32m2_t v10 = VECTOR_LOAD<float, M2>(row1 + ow, vl);
-            vfloat32m2_t v11 = VECTOR_LOAD<float, M2>(row1 + ow + 1, vl);
-            vfloat32m2_t v12 = VECTOR_LOAD<float, M2>(row1 + ow + 2, vl);
-           
-            // Row 2: 3 vectors
-            vfloat32m2_t v20 = VECTOR_LOAD<float, M2>(row2 + ow, vl);
-            vfloat32m2_t v21 = VECTOR_LOAD<float, M2>(row2 + ow + 1, vl);
-            vfloat32m2_t v22 = VECTOR_LOAD<float, M2>(row2 + ow + 2, vl);
-           
-            // ================================================================
-            // COMPUTE PHASE: FMA chain with m2 vectors
-            // ================================================================
-            vfloat32m2_t acc = VECTOR_MUL<float, M2>(v00, k00, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k01, v01, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k02, v02, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k10, v10, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k11, v11, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k12, v12, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k20, v20, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k21, v21, vl);
-            acc = VECTOR_FMACC<float, M2>(acc, k22, v22, vl);
-           
-            // ================================================================
-            // STORE PHASE
-            // ================================================================
-            VECTOR_STORE<float, M2>(out_row + ow, acc, vl);
-           
-            ow += vl;
-        }
-    }
-   
-    // Cleanup
-    if (padded_input) {
-        free(padded_input);
+        conv3x3_sliding<M2, true>(input, H, W, kernel, output);
+    } else {
+        conv3x3_sliding<M2, false>(input, H, W, kernel, output);
     }
 }
 // ============================================================================
@@ -926,137 +1479,32 @@ void conv2d_3x3_m4(
     float* output, // Output: HxW (with padding) or (H-2)x(W-2)
     int H, // Input height
     int W, // Input width
-    bool use_padding // If true, applies zero-padding
+    bool use_padding // If true, applies zero-padding (in-kernel, no padded copy)
 ) {
-    float* padded_input = nullptr;
-    const float* proc_input = input;
-    int H_proc = H;
-    int W_proc = W;
-   
+    // m4: LMUL=4
     if (use_padding) {
-        padded_input = create_padded_input(input, H, W);
-        proc_input = padded_input;
-        H_proc = H + 2;
-        W_proc = W + 2;
+        conv3x3_sliding<M4, true>(input, H, W, kernel, output);
+    } else {
+        conv3x3_sliding<M4, false>(input, H, W, kernel, output);
     }
-   
-    const int out_h = use_padding ? H : (H - 2);
-    const int out_w = use_padding ? W : (W - 2);
-   
-    float k00 = kernel[0], k01 = kernel[1], k02 = kernel[2];
-    float k10 = kernel[3], k11 = kernel[4], k12 = kernel[5];
-    float k20 = kernel[6], k21 = kernel[7], k22 = kernel[8];
-    for (int oh = 0; oh < out_h; oh++) {
-        const float* row0 = proc_input + oh * W_proc;
-        const float* row1 = row0 + W_proc;
-        const float* row2 = row1 + W_proc;
-        float* out_row = output + oh * out_w;
-        int ow = 0;
-        while (ow < out_w) {
-            size_t vl = SET_VECTOR_LENGTH<float, M4>(out_w - ow);
-           
-            // Staged load and compute to reduce register usage
-            vfloat32m4_t acc = VECTOR_LOAD<float, M4>(row0 + ow, vl);
-            acc = VECTOR_MUL<float, M4>(acc, k00, vl);
-           
-            vfloat32m4_t temp = VECTOR_LOAD<float, M4>(row0 + ow + 1, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k01, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M4>(row0 + ow + 2, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k02, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M4>(row1 + ow, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k10, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M4>(row1 + ow + 1, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k11, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M4>(row1 + ow + 2, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k12, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M4>(row2 + ow, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k20, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M4>(row2 + ow + 1, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k21, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M4>(row2 + ow + 2, vl);
-            acc = VECTOR_FMACC<float, M4>(acc, k22, temp, vl);
-           
-            VECTOR_STORE<float, M4>(out_row + ow, acc, vl);
-            ow += vl;
-        }
-    }
-    if (padded_input) free(padded_input);
 }
 // ============================================================================
 // M8 IMPLEMENTATION
 // ============================================================================
 void conv2d_3x3_m8(
-    const float* input,
-    const float* kernel,
-    float* output,
-    int H,
-    int W,
-    bool use_padding
+    const float* input, // Input: HxW
+    const float* kernel, // Kernel: 3x3 (9 elements, row-major)
+    float* output, // Output: HxW (with padding) or (H-2)x(W-2)
+    int H, // Input height
+    int W, // Input width
+    bool use_padding // If true, applies zero-padding (in-kernel, no padded copy)
 ) {
-    float* padded_input = nullptr;
-    const float* proc_input = input;
-    int H_proc = H;
-    int W_proc = W;
+    // m8: LMUL=8, one register group per row vector
     if (use_padding) {
-        padded_input = create_padded_input(input, H, W);
-        proc_input = padded_input;
-        H_proc = H + 2;
-        W_proc = W + 2;
+        conv3x3_sliding<M8, true>(input, H, W, kernel, output);
+    } else {
+        conv3x3_sliding<M8, false>(input, H, W, kernel, output);
     }
-    const int out_h = use_padding ? H : (H - 2);
-    const int out_w = use_padding ? W : (W - 2);
-    float k00 = kernel[0], k01 = kernel[1], k02 = kernel[2];
-    float k10 = kernel[3], k11 = kernel[4], k12 = kernel[5];
-    float k20 = kernel[6], k21 = kernel[7], k22 = kernel[8];
-    for (int oh = 0; oh < out_h; oh++) {
-        const float* row0 = proc_input + oh * W_proc;
-        const float* row1 = row0 + W_proc;
-        const float* row2 = row1 + W_proc;
-        float* out_row = output + oh * out_w;
-        int ow = 0;
-        while (ow < out_w) {
-            size_t vl = SET_VECTOR_LENGTH<float, M8>(out_w - ow);
-           
-            // Staged load and compute to reduce register usage
-            vfloat32m8_t acc = VECTOR_LOAD<float, M8>(row0 + ow, vl);
-            acc = VECTOR_MUL<float, M8>(acc, k00, vl);
-           
-            vfloat32m8_t temp = VECTOR_LOAD<float, M8>(row0 + ow + 1, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k01, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M8>(row0 + ow + 2, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k02, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M8>(row1 + ow, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k10, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M8>(row1 + ow + 1, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k11, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M8>(row1 + ow + 2, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k12, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M8>(row2 + ow, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k20, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M8>(row2 + ow + 1, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k21, temp, vl);
-           
-            temp = VECTOR_LOAD<float, M8>(row2 + ow + 2, vl);
-            acc = VECTOR_FMACC<float, M8>(acc, k22, temp, vl);
-           
-            VECTOR_STORE<float, M8>(out_row + ow, acc, vl);
-            ow += vl;
-        }
-    }
-    if (padded_input) free(padded_input);
 }
 
 
@@ -1073,79 +1521,10 @@ void conv2d_3x3_m2_batched(
     bool use_padding,
     int batch_rows = 4 // Process N output rows together
 ) {
-    float* padded_input = nullptr;
-    const float* proc_input = input;
-    int H_proc = H;
-    int W_proc = W;
-   
     if (use_padding) {
-        padded_input = create_padded_input(input, H, W);
-        proc_input = padded_input;
-        H_proc = H + 2;
-        W_proc = W + 2;
-    }
-   
-    const int out_h = use_padding ? H : (H - 2);
-    const int out_w = use_padding ? W : (W - 2);
-   
-    float k00 = kernel[0], k01 = kernel[1], k02 = kernel[2];
-    float k10 = kernel[3], k11 = kernel[4], k12 = kernel[5];
-    float k20 = kernel[6], k21 = kernel[7], k22 = kernel[8];
-   
-    // Process output rows in batches for better cache reuse
-    for (int oh_base = 0; oh_base < out_h; oh_base += batch_rows) {
-        int rows_to_process = (oh_base + batch_rows <= out_h) ?
-                              batch_rows : (out_h - oh_base);
-       
-        // For each column position (vectorized)
-        for (int ow = 0; ow < out_w; ) {
-            size_t vl = SET_VECTOR_LENGTH<float, M2>(out_w - ow);
-           
-            // Process each row in the current batch
-            for (int r = 0; r < rows_to_process; r++) {
-                int oh = oh_base + r;
-                const float* row0 = proc_input + oh * W_proc;
-                const float* row1 = row0 + W_proc;
-                const float* row2 = row1 + W_proc;
-               
-                // Staged load and compute to reduce register usage
-                vfloat32m2_t acc = VECTOR_LOAD<float, M2>(row0 + ow, vl);
-                acc = VECTOR_MUL<float, M2>(acc, k00, vl);
-               
-                vfloat32m2_t temp = VECTOR_LOAD<float, M2>(row0 + ow + 1, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k01, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M2>(row0 + ow + 2, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k02, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M2>(row1 + ow, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k10, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M2>(row1 + ow + 1, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k11, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M2>(row1 + ow + 2, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k12, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M2>(row2 + ow, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k20, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M2>(row2 + ow + 1, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k21, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M2>(row2 + ow + 2, vl);
-                acc = VECTOR_FMACC<float, M2>(acc, k22, temp, vl);
-               
-                // Store
-                VECTOR_STORE<float, M2>(output + oh * out_w + ow, acc, vl);
-            }
-           
-            ow += vl;
-        }
-    }
-   
-    if (padded_input) {
-        free(padded_input);
+        conv3x3_sliding_batched<M2, true>(input, H, W, kernel, output, batch_rows);
+    } else {
+        conv3x3_sliding_batched<M2, false>(input, H, W, kernel, output, batch_rows);
     }
 }
 // ============================================================================
@@ -1158,68 +1537,13 @@ void conv2d_3x3_m4_batched(
     int H,
     int W,
     bool use_padding,
-    int batch_rows = 4
+    int batch_rows = 4 // Process N output rows together
 ) {
-    float* padded_input = nullptr;
-    const float* proc_input = input;
-    int H_proc = H;
-    int W_proc = W;
     if (use_padding) {
-        padded_input = create_padded_input(input, H, W);
-        proc_input = padded_input;
-        H_proc = H + 2;
-        W_proc = W + 2;
-    }
-    const int out_h = use_padding ? H : (H - 2);
-    const int out_w = use_padding ? W : (W - 2);
-    float k00 = kernel[0], k01 = kernel[1], k02 = kernel[2];
-    float k10 = kernel[3], k11 = kernel[4], k12 = kernel[5];
-    float k20 = kernel[6], k21 = kernel[7], k22 = kernel[8];
-    for (int oh_base = 0; oh_base < out_h; oh_base += batch_rows) {
-        int rows_to_process = (oh_base + batch_rows <= out_h) ?
-                              batch_rows : (out_h - oh_base);
-        for (int ow = 0; ow < out_w; ) {
-            size_t vl = SET_VECTOR_LENGTH<float, M4>(out_w - ow);
-            for (int r = 0; r < rows_to_process; r++) {
-                int oh = oh_base + r;
-                const float* row0 = proc_input + oh * W_proc;
-                const float* row1 = row0 + W_proc;
-                const float* row2 = row1 + W_proc;
-               
-                // Staged load and compute to reduce register usage
-                vfloat32m4_t acc = VECTOR_LOAD<float, M4>(row0 + ow, vl);
-                acc = VECTOR_MUL<float, M4>(acc, k00, vl);
-               
-                vfloat32m4_t temp = VECTOR_LOAD<float, M4>(row0 + ow + 1, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k01, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M4>(row0 + ow + 2, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k02, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M4>(row1 + ow, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k10, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M4>(row1 + ow + 1, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k11, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M4>(row1 + ow + 2, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k12, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M4>(row2 + ow, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k20, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M4>(row2 + ow + 1, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k21, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M4>(row2 + ow + 2, vl);
-                acc = VECTOR_FMACC<float, M4>(acc, k22, temp, vl);
-               
-                VECTOR_STORE<float, M4>(output + oh * out_w + ow, acc, vl);
-            }
-            ow += vl;
-        }
+        conv3x3_sliding_batched<M4, true>(input, H, W, kernel, output, batch_rows);
+    } else {
+        conv3x3_sliding_batched<M4, false>(input, H, W, kernel, output, batch_rows);
     }
-    if (padded_input) free(padded_input);
 }
 // ============================================================================
 // M8 BATCHED
@@ -1231,106 +1555,13 @@ void conv2d_3x3_m8_batched(
     int H,
     int W,
     bool use_padding,
-    int batch_rows = 4
+    int batch_rows = 4 // Process N output rows together
 ) {
-    float* padded_input = nullptr;
-    const float* proc_input = input;
-    int H_proc = H;
-    int W_proc = W;
     if (use_padding) {
-        padded_input = create_padded_input(input, H, W);
-        proc_input = padded_input;
-        H_proc = H + 2;
-        W_proc = W + 2;
-    }
-    const int out_h = use_padding ? H : (H - 2);
-    const int out_w = use_padding ? W : (W - 2);
-    float k00 = kernel[0], k01 = kernel[1], k02 = kernel[2];
-    float k10 = kernel[3], k11 = kernel[4], k12 = kernel[5];
-    float k20 = kernel[6], k21 = kernel[7], k22 = kernel[8];
-    for (int oh_base = 0; oh_base < out_h; oh_base += batch_rows) {
-        int rows_to_process = (oh_base + batch_rows <= out_h) ?
-                              batch_rows : (out_h - oh_base);
-        for (int ow = 0; ow < out_w; ) {
-            size_t vl = SET_VECTOR_LENGTH<float, M8>(out_w - ow);
-            for (int r = 0; r < rows_to_process; r += 2) {
-                int num_rows_this = (r + 2 <= rows_to_process) ? 2 : 1;
-                int oh1 = oh_base + r;
-                const float* row0_1 = proc_input + oh1 * W_proc;
-                const float* row1_1 = row0_1 + W_proc;
-                const float* row2_1 = row1_1 + W_proc;
-               
-                // Staged for first row
-                vfloat32m8_t acc1 = VECTOR_LOAD<float, M8>(row0_1 + ow, vl);
-                acc1 = VECTOR_MUL<float, M8>(acc1, k00, vl);
-               
-                vfloat32m8_t temp = VECTOR_LOAD<float, M8>(row0_1 + ow + 1, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k01, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M8>(row0_1 + ow + 2, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k02, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M8>(row1_1 + ow, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k10, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M8>(row1_1 + ow + 1, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k11, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M8>(row1_1 + ow + 2, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k12, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M8>(row2_1 + ow, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k20, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M8>(row2_1 + ow + 1, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k21, temp, vl);
-               
-                temp = VECTOR_LOAD<float, M8>(row2_1 + ow + 2, vl);
-                acc1 = VECTOR_FMACC<float, M8>(acc1, k22, temp, vl);
-               
-                VECTOR_STORE<float, M8>(output + oh1 * out_w + ow, acc1, vl);
-               
-                if (num_rows_this == 2) {
-                    int oh2 = oh1 + 1;
-                    const float* row0_2 = proc_input + oh2 * W_proc;
-                    const float* row1_2 = row0_2 + W_proc;
-                    const float* row2_2 = row1_2 + W_proc;
-                   
-                    // Staged for second row
-                    vfloat32m8_t acc2 = VECTOR_LOAD<float, M8>(row0_2 + ow, vl);
-                    acc2 = VECTOR_MUL<float, M8>(acc2, k00, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row0_2 + ow + 1, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k01, temp, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row0_2 + ow + 2, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k02, temp, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row1_2 + ow, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k10, temp, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row1_2 + ow + 1, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k11, temp, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row1_2 + ow + 2, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k12, temp, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row2_2 + ow, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k20, temp, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row2_2 + ow + 1, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k21, temp, vl);
-                   
-                    temp = VECTOR_LOAD<float, M8>(row2_2 + ow + 2, vl);
-                    acc2 = VECTOR_FMACC<float, M8>(acc2, k22, temp, vl);
-                   
-                    VECTOR_STORE<float, M8>(output + oh2 * out_w + ow, acc2, vl);
-                }
-            }
-            ow += vl;
-        }
+        conv3x3_sliding_batched<M8, true>(input, H, W, kernel, output, batch_rows);
+    } else {
+        conv3x3_sliding_batched<M8, false>(input, H, W, kernel, output, batch_rows);
     }
-    if (padded_input) free(padded_input);
 }
 
 /********************************* 3x3 Filter-Specific RGB Vectorized Versions *********************************/
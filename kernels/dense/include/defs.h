@@ -19,6 +19,33 @@ void dense_e32m4(const float* input, const float* weights, const float* bias,
 void dense_e32m8(const float* input, const float* weights, const float* bias,
    float* output, size_t in_features, size_t out_features);
 
+// --- Dense with [IN x OUT] weights ---
+void dense_t_e32m1(const float* input, const float* weights, const float* bias,
+   float* output, size_t in_features, size_t out_features);
+
+void dense_t_e32m2(const float* input, const float* weights, const float* bias,
+   float* output, size_t in_features, size_t out_features);
+
+void dense_t_e32m4(const float* input, const float* weights, const float* bias,
+   float* output, size_t in_features, size_t out_features);
+
+void dense_t_e32m8(const float* input, const float* weights, const float* bias,
+   float* output, size_t in_features, size_t out_features);
+
+// --- Batched dense: input [batch x IN], output [batch x OUT] (GEMV below a batch threshold, GEMM above) ---
+void dense_batched(const float* input, const float* weights, const float* bias,
+   float* output, size_t batch, size_t in_features, size_t out_features);
+
+// --- Dense with prepacked weights (e32m8) ---
+// Opaque handle holding [OUT x IN] weights in GEMM panel layout; pack once, reuse per call
+struct PackedWeights;
+
+PackedWeights* pack_weights(const float* weights, size_t in_features, size_t out_features);
+void free_packed_weights(PackedWeights* w);
+
+// input [batch x IN] -> output [batch x OUT], one GEMM on the packed panels
+void dense_prepacked(const float* input, const PackedWeights* w, const float* bias, float* output,
+   size_t batch);
 
 // --- Utils ---
 void write_matrix_to_file(const char* filename, float* matrix, std::size_t rows, std::size_t cols);
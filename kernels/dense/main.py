@@ -32,7 +32,7 @@ except FileNotFoundError:
 
 
 # Default sizes
-B, IN, OUT = 1, 16, 16
+B, IN, OUT = 4, 16, 16
 
 if len(sys.argv) == 4:
     try:
@@ -40,8 +40,8 @@ if len(sys.argv) == 4:
         IN = int(sys.argv[2])
         OUT = int(sys.argv[3])
     except ValueError:
-        print(f"Invalid size arguments. Using defaults B=1, IN=16, OUT=16.")
-        B, IN, OUT = 1, 16, 16
+        print(f"Invalid size arguments. Using defaults B=4, IN=16, OUT=16.")
+        B, IN, OUT = 4, 16, 16
 
 # ==== Load All Input Data ====
 def load_data(filename, shape):
@@ -87,6 +87,12 @@ implementations = [
     ("C Vectorized (e32m2)", load_result("dense_e32m2.bin", output_shape)),
     ("C Vectorized (e32m4)", load_result("dense_e32m4.bin", output_shape)),
     ("C Vectorized (e32m8)", load_result("dense_e32m8.bin", output_shape)),
+    ("C [IN,OUT] W (e32m1)", load_result("dense_t_e32m1.bin", output_shape)),
+    ("C [IN,OUT] W (e32m2)", load_result("dense_t_e32m2.bin", output_shape)),
+    ("C [IN,OUT] W (e32m4)", load_result("dense_t_e32m4.bin", output_shape)),
+    ("C [IN,OUT] W (e32m8)", load_result("dense_t_e32m8.bin", output_shape)),
+    ("C Batched (e32m8)", load_result("dense_batched.bin", output_shape)),
+    ("C Prepacked (e32m8)", load_result("dense_prepacked.bin", output_shape)),
 ]
 
 # ==== Results Table ====
@@ -13,7 +13,7 @@ void init_matrix(float* matrix, size_t count) {
 
 int main(int argc, char* argv[]) {
     // --- HANDLE ARGUMENTS ---
-    size_t B = 1;  // batch_size
+    size_t B = 4;  // batch_size (>= DENSE_GEMM_MIN_BATCH, so dense_batched runs its GEMM path)
     size_t IN = 16; // in_features
     size_t OUT = 16; // out_features
 
@@ -23,7 +23,7 @@ int main(int argc, char* argv[]) {
         OUT = static_cast<size_t>(atoi(argv[3]));
         if (B == 0 || IN == 0 || OUT == 0) {
             cerr << "Invalid arguments. Using defaults." << endl;
-            B = 1; IN = 16; OUT = 16;
+            B = 4; IN = 16; OUT = 16;
         }
     } else {
         cerr << "Usage: " << argv[0] << " <batch_size> <in_features> <out_features>" << endl;
@@ -58,22 +58,61 @@ int main(int argc, char* argv[]) {
     // --- RUN KERNELS ---
 
     /***** Scalar Dense *****/
-    dense_scalar(input, weights, bias, output, IN, OUT);
+    for (size_t b = 0; b < B; b++)
+        dense_scalar(input + b * IN, weights, bias, output + b * OUT, IN, OUT);
     write_matrix_binary("./output_files/dense_scalar.bin", output, B * OUT);
 
     /***** Dense Vectorized e32mx *****/
-    dense_e32m1(input, weights, bias, output, IN, OUT);
+    for (size_t b = 0; b < B; b++)
+        dense_e32m1(input + b * IN, weights, bias, output + b * OUT, IN, OUT);
     write_matrix_binary("./output_files/dense_e32m1.bin", output, B * OUT);
 
-    dense_e32m2(input, weights, bias, output, IN, OUT);
+    for (size_t b = 0; b < B; b++)
+        dense_e32m2(input + b * IN, weights, bias, output + b * OUT, IN, OUT);
     write_matrix_binary("./output_files/dense_e32m2.bin", output, B * OUT);
 
-    dense_e32m4(input, weights, bias, output, IN, OUT);
+    for (size_t b = 0; b < B; b++)
+        dense_e32m4(input + b * IN, weights, bias, output + b * OUT, IN, OUT);
     write_matrix_binary("./output_files/dense_e32m4.bin", output, B * OUT);
 
-    dense_e32m8(input, weights, bias, output, IN, OUT);
+    for (size_t b = 0; b < B; b++)
+        dense_e32m8(input + b * IN, weights, bias, output + b * OUT, IN, OUT);
     write_matrix_binary("./output_files/dense_e32m8.bin", output, B * OUT);
 
+    /***** Dense Vectorized e32mx, [IN x OUT] weights *****/
+    float* weights_t = new float[IN * OUT];
+    for (size_t o = 0; o < OUT; o++)
+        for (size_t i = 0; i < IN; i++)
+            weights_t[i * OUT + o] = weights[o * IN + i];
+
+    for (size_t b = 0; b < B; b++)
+        dense_t_e32m1(input + b * IN, weights_t, bias, output + b * OUT, IN, OUT);
+    write_matrix_binary("./output_files/dense_t_e32m1.bin", output, B * OUT);
+
+    for (size_t b = 0; b < B; b++)
+        dense_t_e32m2(input + b * IN, weights_t, bias, output + b * OUT, IN, OUT);
+    write_matrix_binary("./output_files/dense_t_e32m2.bin", output, B * OUT);
+
+    for (size_t b = 0; b < B; b++)
+        dense_t_e32m4(input + b * IN, weights_t, bias, output + b * OUT, IN, OUT);
+    write_matrix_binary("./output_files/dense_t_e32m4.bin", output, B * OUT);
+
+    for (size_t b = 0; b < B; b++)
+        dense_t_e32m8(input + b * IN, weights_t, bias, output + b * OUT, IN, OUT);
+    write_matrix_binary("./output_files/dense_t_e32m8.bin", output, B * OUT);
+
+    delete[] weights_t;
+
+    /***** Dense Batched (all B samples) *****/
+    dense_batched(input, weights, bias, output, B, IN, OUT);
+    write_matrix_binary("./output_files/dense_batched.bin", output, B * OUT);
+
+    /***** Dense with prepacked weights (packed once, outside the call) *****/
+    PackedWeights* packed = pack_weights(weights, IN, OUT);
+    dense_prepacked(input, packed, bias, output, B);
+    write_matrix_binary("./output_files/dense_prepacked.bin", output, B * OUT);
+    free_packed_weights(packed);
+
     // --- CLEANUP ---
     delete[] input;
     delete[] weights;
@@ -1,6 +1,10 @@
 #include <cstddef>
+#include <cstring>
 #include <riscv_vector.h>
 #include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_gemv.hpp"
+#include "rvv_dense.hpp"
 
 using namespace std;
 
@@ -29,141 +33,131 @@ void dense_scalar(const float* input, const float* weights, const float* bias,
 }
 
 /********************************* Vectorized Versions (Non-Batched) *********************************/
+// Batch 1 is a matrix-vector product, so all variants run the GEMV kernel (lib/rvv_gemv.hpp):
+// weights are [OUT x IN], every row is streamed contiguously along IN and dotted with the
+// input, with several rows in flight and one reduction per row.
 
 void dense_e32m1(const float* input, const float* weights, const float* bias,
 	float* output, size_t in_features, size_t out_features) {
-	 
-	 size_t K = in_features;
-	 size_t N = out_features;
- 
-	 // We iterate through outputs (j)
-	 for (size_t j_idx = 0; j_idx < N; ) {
-		 size_t vl = SET_VECTOR_LENGTH<float, M1>(N - j_idx);
- 
-		 // 1. Initialize with bias
-		 auto v_acc = VECTOR_LOAD<float, M1>(&bias[j_idx], vl);
- 
-		 // 2. Since weights are [OUT, IN], we can't easily broadcast input[k] 
-		 // across weights[k*N+j] like we did before.
-		 // Instead, we compute the dot product for each j in the vector.
-		 
-		 // REVISED LOGIC: For each j in the current vector segment
-		 for (size_t k = 0; k < K; k++) {
-			 // We need to load weights[j_idx...j_idx+vl][k]
-			 // BUT: In [N x K] layout, the elements weights[j][k] and weights[j+1][k] 
-			 // are NOT contiguous. They are K elements apart.
-			 
-			 // This requires a STRIDED LOAD
-			 auto v_w = VECTOR_STRIDED_LOAD<float, M1>(&weights[j_idx * K + k], K * sizeof(float), vl);
-			 auto v_in = VECTOR_MOVE<float, M1>(input[k], vl);
-			 v_acc = VECTOR_FMACC<float, M1>(v_acc, v_in, v_w, vl);
-		 }
- 
-		 VECTOR_STORE<float, M1>(&output[j_idx], v_acc, vl);
-		 j_idx += vl;
-	 }
- }
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + weights * input
+	memcpy(output, bias, N * sizeof(float));
+	gemv_n<float, M1>(N, K, weights, K, input, output, true);
+}
 
 void dense_e32m2(const float* input, const float* weights, const float* bias,
 	float* output, size_t in_features, size_t out_features) {
-	 
-	 size_t K = in_features;
-	 size_t N = out_features;
- 
-	 // We iterate through outputs (j)
-	 for (size_t j_idx = 0; j_idx < N; ) {
-		 size_t vl = SET_VECTOR_LENGTH<float, M2>(N - j_idx);
- 
-		 // 1. Initialize with bias
-		 auto v_acc = VECTOR_LOAD<float, M2>(&bias[j_idx], vl);
- 
-		 // 2. Since weights are [OUT, IN], we can't easily broadcast input[k] 
-		 // across weights[k*N+j] like we did before.
-		 // Instead, we compute the dot product for each j in the vector.
-		 
-		 // REVISED LOGIC: For each j in the current vector segment
-		 for (size_t k = 0; k < K; k++) {
-			 // We need to load weights[j_idx...j_idx+vl][k]
-			 // BUT: In [N x K] layout, the elements weights[j][k] and weights[j+1][k] 
-			 // are NOT contiguous. They are K elements apart.
-			 
-			 // This requires a STRIDED LOAD
-			 auto v_w = VECTOR_STRIDED_LOAD<float, M2>(&weights[j_idx * K + k], K * sizeof(float), vl);
-			 auto v_in = VECTOR_MOVE<float, M2>(input[k], vl);
-			 v_acc = VECTOR_FMACC<float, M2>(v_acc, v_in, v_w, vl);
-		 }
- 
-		 VECTOR_STORE<float, M2>(&output[j_idx], v_acc, vl);
-		 j_idx += vl;
-	 }
- }
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + weights * input
+	memcpy(output, bias, N * sizeof(float));
+	gemv_n<float, M2>(N, K, weights, K, input, output, true);
+}
 
 void dense_e32m4(const float* input, const float* weights, const float* bias,
 	float* output, size_t in_features, size_t out_features) {
-	 
-	 size_t K = in_features;
-	 size_t N = out_features;
- 
-	 // We iterate through outputs (j)
-	 for (size_t j_idx = 0; j_idx < N; ) {
-		 size_t vl = SET_VECTOR_LENGTH<float, M4>(N - j_idx);
- 
-		 // 1. Initialize with bias
-		 auto v_acc = VECTOR_LOAD<float, M4>(&bias[j_idx], vl);
- 
-		 // 2. Since weights are [OUT, IN], we can't easily broadcast input[k] 
-		 // across weights[k*N+j] like we did before.
-		 // Instead, we compute the dot product for each j in the vector.
-		 
-		 // REVISED LOGIC: For each j in the current vector segment
-		 for (size_t k = 0; k < K; k++) {
-			 // We need to load weights[j_idx...j_idx+vl][k]
-			 // BUT: In [N x K] layout, the elements weights[j][k] and weights[j+1][k] 
-			 // are NOT contiguous. They are K elements apart.
-			 
-			 // This requires a STRIDED LOAD
-			 auto v_w = VECTOR_STRIDED_LOAD<float, M4>(&weights[j_idx * K + k], K * sizeof(float), vl);
-			 auto v_in = VECTOR_MOVE<float, M4>(input[k], vl);
-			 v_acc = VECTOR_FMACC<float, M4>(v_acc, v_in, v_w, vl);
-		 }
- 
-		 VECTOR_STORE<float, M4>(&output[j_idx], v_acc, vl);
-		 j_idx += vl;
-	 }
- }
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + weights * input
+	memcpy(output, bias, N * sizeof(float));
+	gemv_n<float, M4>(N, K, weights, K, input, output, true);
+}
 
 void dense_e32m8(const float* input, const float* weights, const float* bias,
 	float* output, size_t in_features, size_t out_features) {
-	 
-	 size_t K = in_features;
-	 size_t N = out_features;
- 
-	 // We iterate through outputs (j)
-	 for (size_t j_idx = 0; j_idx < N; ) {
-		 size_t vl = SET_VECTOR_LENGTH<float, M8>(N - j_idx);
- 
-		 // 1. Initialize with bias
-		 auto v_acc = VECTOR_LOAD<float, M8>(&bias[j_idx], vl);
- 
-		 // 2. Since weights are [OUT, IN], we can't easily broadcast input[k] 
-		 // across weights[k*N+j] like we did before.
-		 // Instead, we compute the dot product for each j in the vector.
-		 
-		 // REVISED LOGIC: For each j in the current vector segment
-		 for (size_t k = 0; k < K; k++) {
-			 // We need to load weights[j_idx...j_idx+vl][k]
-			 // BUT: In [N x K] layout, the elements weights[j][k] and weights[j+1][k] 
-			 // are NOT contiguous. They are K elements apart.
-			 
-			 // This requires a STRIDED LOAD
-			 auto v_w = VECTOR_STRIDED_LOAD<float, M8>(&weights[j_idx * K + k], K * sizeof(float), vl);
-			 auto v_in = VECTOR_MOVE<float, M8>(input[k], vl);
-			 v_acc = VECTOR_FMACC<float, M8>(v_acc, v_in, v_w, vl);
-		 }
- 
-		 VECTOR_STORE<float, M8>(&output[j_idx], v_acc, vl);
-		 j_idx += vl;
-	 }
- }
-
- 
\ No newline at end of file
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + weights * input
+	memcpy(output, bias, N * sizeof(float));
+	gemv_n<float, M8>(N, K, weights, K, input, output, true);
+}
+
+/************************* Vectorized Versions, [IN x OUT] Weights (Non-Batched) *************************/
+// Weights stored input-major (ONNX Gemm with transB = 0): each weight row spans OUT and is
+// scaled by one input element, so the loads stay contiguous and no reduction is needed.
+
+void dense_t_e32m1(const float* input, const float* weights, const float* bias,
+	float* output, size_t in_features, size_t out_features) {
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + input * weights
+	memcpy(output, bias, N * sizeof(float));
+	gemv_t<float, M1>(N, K, weights, N, input, output, true);
+}
+
+void dense_t_e32m2(const float* input, const float* weights, const float* bias,
+	float* output, size_t in_features, size_t out_features) {
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + input * weights
+	memcpy(output, bias, N * sizeof(float));
+	gemv_t<float, M2>(N, K, weights, N, input, output, true);
+}
+
+void dense_t_e32m4(const float* input, const float* weights, const float* bias,
+	float* output, size_t in_features, size_t out_features) {
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + input * weights
+	memcpy(output, bias, N * sizeof(float));
+	gemv_t<float, M4>(N, K, weights, N, input, output, true);
+}
+
+void dense_t_e32m8(const float* input, const float* weights, const float* bias,
+	float* output, size_t in_features, size_t out_features) {
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + input * weights
+	memcpy(output, bias, N * sizeof(float));
+	gemv_t<float, M8>(N, K, weights, N, input, output, true);
+}
+
+/********************************* Batched Version *********************************/
+// input: [batch x IN], weights: [OUT x IN], output: [batch x OUT]
+// GEMV per sample or one GEMM for the batch, cutoff DENSE_GEMM_MIN_BATCH (lib/rvv_dense.hpp)
+
+void dense_batched(const float* input, const float* weights, const float* bias,
+	float* output, size_t batch, size_t in_features, size_t out_features) {
+	dense_batched<M8>(input, weights, bias, output, batch, in_features, out_features);
+}
+
+/********************************* Prepacked Weights *********************************/
+// The weights are packed into GEMM panels once (pack_weights, at model load), so every
+// dense_prepacked call runs its batch as one GEMM without the per-call weight packing of
+// dense_batched (lib/rvv_dense.hpp).
+
+struct PackedWeights {
+	GemmPackedB<float, M8> b;
+};
+
+PackedWeights* pack_weights(const float* weights, size_t in_features, size_t out_features) {
+	PackedWeights* w = new PackedWeights;
+	dense_prepack<M8>(weights, in_features, out_features, w->b);
+	return w;
+}
+
+void free_packed_weights(PackedWeights* w) {
+	delete w;
+}
+
+void dense_prepacked(const float* input, const PackedWeights* w, const float* bias, float* output,
+	size_t batch) {
+	dense_prepacked<M8>(input, w->b, bias, output, batch);
+}
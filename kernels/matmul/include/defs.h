@@ -2,6 +2,10 @@
 #define DEFS_H
 
 #include <cstddef>
+#include <cstdint>
+
+// Highest tensor rank accepted by matmul_batched_*
+#define MATMUL_MAX_DIMS 8
 
 // Scalar
 void matmul_scalar(float* A, float* B, float* C, std::size_t M, std::size_t N, std::size_t K);
@@ -69,9 +73,100 @@ void matmul_tiled_e32m8(const float* A, const float* B, float* C,
 	size_t M, size_t N, size_t K,
 	size_t tile_m, size_t tile_n, size_t tile_k);
 
+// Packed Panels
+void matmul_packed_e32m1(const float* A, const float* B, float* C, size_t M, size_t N, size_t K);
+void matmul_packed_e32m2(const float* A, const float* B, float* C, size_t M, size_t N, size_t K);
+void matmul_packed_e32m4(const float* A, const float* B, float* C, size_t M, size_t N, size_t K);
+void matmul_packed_e32m8(const float* A, const float* B, float* C, size_t M, size_t N, size_t K);
+
+// Packed Panels, multi-threaded
+void matmul_packed_mt_e32m1(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+void matmul_packed_mt_e32m2(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+void matmul_packed_mt_e32m4(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+void matmul_packed_mt_e32m8(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+
+// Packed Panels, split-K (partial C per K slice, vector reduction)
+void matmul_packed_splitk_e32m1(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+void matmul_packed_splitk_e32m2(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+void matmul_packed_splitk_e32m4(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+void matmul_packed_splitk_e32m8(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, int num_threads);
+
+// Packed Panels, transposed operands (A stored [K x M] / B stored [N x K])
+void matmul_packed_trans_e32m1(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b);
+void matmul_packed_trans_e32m2(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b);
+void matmul_packed_trans_e32m4(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b);
+void matmul_packed_trans_e32m8(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b);
+
+// Packed Panels, B prepacked once (opaque handle, e32m8 layout); C[M x N] = A[M x K] * B
+struct PackedWeights;
+PackedWeights* pack_weights(const float* B, size_t K, size_t N);
+void free_packed_weights(PackedWeights* w);
+void matmul_prepacked(const float* A, const PackedWeights* B, float* C, size_t M);
+
+// Packed Panels, fp16 inputs with fp32 accumulation (vfwmacc)
+void matmul_packed_f16_e16m1(const _Float16* A, const _Float16* B, float* C, size_t M, size_t N, size_t K);
+void matmul_packed_f16_e16m2(const _Float16* A, const _Float16* B, float* C, size_t M, size_t N, size_t K);
+void matmul_packed_f16_e16m4(const _Float16* A, const _Float16* B, float* C, size_t M, size_t N, size_t K);
+
+// Packed Panels, int8 inputs with int32 accumulation (vwmacc); za / zb are zero points
+void matmul_scalar_s8(const int8_t* A, const int8_t* B, int32_t* C, size_t M, size_t N, size_t K, int32_t za, int32_t zb);
+void matmul_packed_s8_e8m1(const int8_t* A, const int8_t* B, int32_t* C, size_t M, size_t N, size_t K, int32_t za, int32_t zb);
+void matmul_packed_s8_e8m2(const int8_t* A, const int8_t* B, int32_t* C, size_t M, size_t N, size_t K, int32_t za, int32_t zb);
+
+// Packed Panels, int8 result requantized per tensor / per row of C (vnclip)
+void quantize_multiplier(double scale, int32_t* multiplier, int32_t* shift);
+void matmul_packed_q8_e8m1(const int8_t* A, const int8_t* B, int8_t* Y, size_t M, size_t N, size_t K,
+	int32_t za, int32_t zb, const int32_t* multiplier, const int32_t* shift, const int32_t* bias,
+	int32_t zy, bool per_channel);
+void matmul_packed_q8_e8m2(const int8_t* A, const int8_t* B, int8_t* Y, size_t M, size_t N, size_t K,
+	int32_t za, int32_t zb, const int32_t* multiplier, const int32_t* shift, const int32_t* bias,
+	int32_t zy, bool per_channel);
+
+// Strassen-Winograd over the packed engine
+void matmul_strassen_e32m8(const float* A, const float* B, float* C, size_t M, size_t N, size_t K, size_t cutoff);
+
+// Batched
+void matmul_strided_batched_e32m1(const float* A, const float* B, float* C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c);
+void matmul_strided_batched_e32m2(const float* A, const float* B, float* C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c);
+void matmul_strided_batched_e32m4(const float* A, const float* B, float* C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c);
+void matmul_strided_batched_e32m8(const float* A, const float* B, float* C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c);
+
+int matmul_batched_shape(const size_t* a_shape, size_t a_ndim, const size_t* b_shape, size_t b_ndim, size_t* c_shape);
+
+void matmul_batched_e32m1(const float* A, const size_t* a_shape, size_t a_ndim,
+	const float* B, const size_t* b_shape, size_t b_ndim, float* C);
+void matmul_batched_e32m2(const float* A, const size_t* a_shape, size_t a_ndim,
+	const float* B, const size_t* b_shape, size_t b_ndim, float* C);
+void matmul_batched_e32m4(const float* A, const size_t* a_shape, size_t a_ndim,
+	const float* B, const size_t* b_shape, size_t b_ndim, float* C);
+void matmul_batched_e32m8(const float* A, const size_t* a_shape, size_t a_ndim,
+	const float* B, const size_t* b_shape, size_t b_ndim, float* C);
+
+// Double precision (f64)
+void matmul_scalar(const double* A, const double* B, double* C, std::size_t M, std::size_t N, std::size_t K);
+void matmul_packed_e64m1(const double* A, const double* B, double* C, size_t M, size_t N, size_t K);
+void matmul_packed_e64m2(const double* A, const double* B, double* C, size_t M, size_t N, size_t K);
+void matmul_packed_e64m4(const double* A, const double* B, double* C, size_t M, size_t N, size_t K);
+void matmul_packed_e64m8(const double* A, const double* B, double* C, size_t M, size_t N, size_t K);
+
+// Templated front end, instantiated for float and double
+template<typename T>
+void matmul(const T* A, const T* B, T* C, size_t M, size_t N, size_t K);
+
+// BLAS-3 xGEMM: C = alpha * op(A) * op(B) + beta * C (row-major, leading dimensions)
+template<typename T>
+void matmul_gemm(bool trans_a, bool trans_b, size_t M, size_t N, size_t K,
+	T alpha, const T* A, size_t lda, const T* B, size_t ldb, T beta, T* C, size_t ldc);
 
 // Utils
 void write_matrix_to_file(const char* filename, float* matrix, std::size_t rows, std::size_t cols);
 void write_matrix_binary(const char* filename, float* matrix, std::size_t count);
+void write_matrix_binary(const char* filename, double* matrix, std::size_t count);
+void write_matrix_binary(const char* filename, int32_t* matrix, std::size_t count);
+void write_matrix_binary(const char* filename, int8_t* matrix, std::size_t count);
 
 #endif
\ No newline at end of file
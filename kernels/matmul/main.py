@@ -113,6 +113,64 @@ c_tiled_e32m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_tiled_e32
 c_tiled_e32m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_tiled_e32m4.bin"), dtype=np.float32).reshape(M, N)
 c_tiled_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_tiled_e32m8.bin"), dtype=np.float32).reshape(M, N)
 
+# ==== C Packed Panels Version ====
+c_packed_e32m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e32m1.bin"), dtype=np.float32).reshape(M, N)
+c_packed_e32m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e32m2.bin"), dtype=np.float32).reshape(M, N)
+c_packed_e32m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e32m4.bin"), dtype=np.float32).reshape(M, N)
+c_packed_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e32m8.bin"), dtype=np.float32).reshape(M, N)
+
+# ==== C Packed Panels, Prepacked B ====
+c_prepacked_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_prepacked_e32m8.bin"), dtype=np.float32).reshape(M, N)
+
+# ==== C Packed Panels Multi-threaded Version ====
+c_packed_mt_e32m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_mt_e32m1.bin"), dtype=np.float32).reshape(M, N)
+c_packed_mt_e32m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_mt_e32m2.bin"), dtype=np.float32).reshape(M, N)
+c_packed_mt_e32m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_mt_e32m4.bin"), dtype=np.float32).reshape(M, N)
+c_packed_mt_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_mt_e32m8.bin"), dtype=np.float32).reshape(M, N)
+
+# ==== C Packed Panels Split-K Version ====
+c_packed_splitk_e32m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_splitk_e32m1.bin"), dtype=np.float32).reshape(M, N)
+c_packed_splitk_e32m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_splitk_e32m2.bin"), dtype=np.float32).reshape(M, N)
+c_packed_splitk_e32m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_splitk_e32m4.bin"), dtype=np.float32).reshape(M, N)
+c_packed_splitk_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_splitk_e32m8.bin"), dtype=np.float32).reshape(M, N)
+
+# ==== C Packed Panels Transposed-operand Version ====
+c_packed_ta_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_ta_e32m8.bin"), dtype=np.float32).reshape(M, N)
+c_packed_tb_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_tb_e32m8.bin"), dtype=np.float32).reshape(M, N)
+c_packed_tab_e32m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_tab_e32m1.bin"), dtype=np.float32).reshape(M, N)
+c_packed_tab_e32m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_tab_e32m2.bin"), dtype=np.float32).reshape(M, N)
+c_packed_tab_e32m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_tab_e32m4.bin"), dtype=np.float32).reshape(M, N)
+c_packed_tab_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_tab_e32m8.bin"), dtype=np.float32).reshape(M, N)
+
+# ==== C fp16 Inputs / fp32 Accumulation Version ====
+c_packed_f16_e16m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_f16_e16m1.bin"), dtype=np.float32).reshape(M, N)
+c_packed_f16_e16m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_f16_e16m2.bin"), dtype=np.float32).reshape(M, N)
+c_packed_f16_e16m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_f16_e16m4.bin"), dtype=np.float32).reshape(M, N)
+
+# ==== C int8 Inputs / int32 Accumulation Version ====
+A_q8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/A_q8.bin"), dtype=np.int8).reshape(M, K)
+B_q8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/B_q8.bin"), dtype=np.int8).reshape(K, N)
+c_scalar_s8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_scalar_s8.bin"), dtype=np.int32).reshape(M, N)
+c_packed_s8_e8m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_s8_e8m1.bin"), dtype=np.int32).reshape(M, N)
+c_packed_s8_e8m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_s8_e8m2.bin"), dtype=np.int32).reshape(M, N)
+c_packed_q8_e8m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_q8_e8m1.bin"), dtype=np.float32).reshape(M, N)
+c_packed_q8_e8m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_q8_e8m2.bin"), dtype=np.float32).reshape(M, N)
+
+# Zero points used by run_matmul.cpp (A: 3, B: -5); the int32 results must match exactly
+ref_s8 = (A_q8.astype(np.int64) - 3) @ (B_q8.astype(np.int64) + 5)
+
+# ==== C Strassen-Winograd Version ====
+c_strassen_e32m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_strassen_e32m8.bin"), dtype=np.float32).reshape(M, N)
+
+# ==== C Double Precision (f64) Versions ====
+c_scalar_f64 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_scalar_f64.bin"), dtype=np.float64).reshape(M, N)
+c_gemm_f64 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_gemm_f64.bin"), dtype=np.float64).reshape(M, N)
+c_packed_e64m1 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e64m1.bin"), dtype=np.float64).reshape(M, N)
+c_packed_e64m2 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e64m2.bin"), dtype=np.float64).reshape(M, N)
+c_packed_e64m4 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e64m4.bin"), dtype=np.float64).reshape(M, N)
+c_packed_e64m8 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_packed_e64m8.bin"), dtype=np.float64).reshape(M, N)
+c_matmul_f64 = np.fromfile(os.path.join(SCRIPT_DIR, "./output_files/c_matmul_f64.bin"), dtype=np.float64).reshape(M, N)
+
 # ONNX --> golden reference
 c_ref = onnx_ref
 
@@ -133,6 +191,38 @@ implementations = [
 	("C Tiled e32m2", c_tiled_e32m2),
 	("C Tiled e32m4", c_tiled_e32m4),
 	("C Tiled e32m8", c_tiled_e32m8),
+	("C Packed e32m1", c_packed_e32m1),
+	("C Packed e32m2", c_packed_e32m2),
+	("C Packed e32m4", c_packed_e32m4),
+	("C Packed e32m8", c_packed_e32m8),
+	("C Prepacked e32m8", c_prepacked_e32m8),
+	("C Packed MT e32m1", c_packed_mt_e32m1),
+	("C Packed MT e32m2", c_packed_mt_e32m2),
+	("C Packed MT e32m4", c_packed_mt_e32m4),
+	("C Packed MT e32m8", c_packed_mt_e32m8),
+	("C Packed Split-K e32m1", c_packed_splitk_e32m1),
+	("C Packed Split-K e32m2", c_packed_splitk_e32m2),
+	("C Packed Split-K e32m4", c_packed_splitk_e32m4),
+	("C Packed Split-K e32m8", c_packed_splitk_e32m8),
+	("C Packed A^T e32m8", c_packed_ta_e32m8),
+	("C Packed B^T e32m8", c_packed_tb_e32m8),
+	("C Packed A^T B^T e32m1", c_packed_tab_e32m1),
+	("C Packed A^T B^T e32m2", c_packed_tab_e32m2),
+	("C Packed A^T B^T e32m4", c_packed_tab_e32m4),
+	("C Packed A^T B^T e32m8", c_packed_tab_e32m8),
+	("C Strassen e32m8", c_strassen_e32m8),
+	("C Packed fp16 e16m1", c_packed_f16_e16m1),
+	("C Packed fp16 e16m2", c_packed_f16_e16m2),
+	("C Packed fp16 e16m4", c_packed_f16_e16m4),
+	("C Packed q8 e8m1", c_packed_q8_e8m1),
+	("C Packed q8 e8m2", c_packed_q8_e8m2),
+	("C Scalar f64", c_scalar_f64),
+	("C Packed e64m1", c_packed_e64m1),
+	("C Packed e64m2", c_packed_e64m2),
+	("C Packed e64m4", c_packed_e64m4),
+	("C Packed e64m8", c_packed_e64m8),
+	("C matmul<double>", c_matmul_f64),
+	("C gemm<double> B^T", c_gemm_f64),
 ]
 
 print(f"\n{'Implementation':<25}{'Max Abs Error':<20}{'SNR (dB)':<20}")
@@ -142,3 +232,9 @@ for name, result in implementations:
     mae = max_abs_error(c_ref, result)
     snr = snr_db(c_ref, result)
     print(f"{name:<25}{mae:<20.6g}{snr:<20.6g}")
+
+print(f"\n{'int8 -> int32':<25}{'Mismatches':<20}")
+print("-" * 45)
+for name, result in [("C Scalar s8", c_scalar_s8), ("C Packed s8 e8m1", c_packed_s8_e8m1),
+                     ("C Packed s8 e8m2", c_packed_s8_e8m2)]:
+    print(f"{name:<25}{int(np.count_nonzero(result != ref_s8)):<20}")
@@ -2,10 +2,26 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include "./include/defs.h"
 
 using namespace std;
 
+// Wall time of one call of f, in ms
+template<typename F>
+static double time_ms(F&& f) {
+    auto t0 = chrono::high_resolution_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - t0).count();
+}
+
+// Positive integer from the environment (set by `make run`), def when unset or invalid
+static size_t env_size(const char* name, size_t def) {
+    const char* env = getenv(name);
+    return (env && atoi(env) > 0) ? static_cast<size_t>(atoi(env)) : def;
+}
+
 int main(int argc, char* argv[]) {
     // --- HANDLE ARGUMENTS ---
     size_t M = 4, N = 4, K = 4; // defaults
@@ -72,6 +88,11 @@ int main(int argc, char* argv[]) {
     cout << "Tile size: " << tilesize << endl;
     cout << "Total operations: " << (2.0 * M * N * K / 1e6) << " million FLOPs" << endl;
 
+    // Multi-threaded GEMM workers and Strassen-Winograd cutoff
+    const int num_threads = static_cast<int>(env_size("GEMM_THREADS", 4));
+    const size_t strassen_cutoff = env_size("STRASSEN_CUTOFF", 128);
+    cout << "GEMM threads: " << num_threads << endl;
+
     // --- MEMORY ALLOCATION ---
     float* A = new float[M * K];
     float* B = new float[K * N];
@@ -98,6 +119,9 @@ int main(int argc, char* argv[]) {
     matmul_scalar(A, B, C, M, N, K);
     write_matrix_binary("./output_files/c_scalar.bin", C, M * N);
 
+	float* C_scalar = new float[M * N];
+	memcpy(C_scalar, C, M * N * sizeof(float));
+
 	// vector
 	matmul_e32m1(A, B, C, M, N, K);
     write_matrix_binary("./output_files/c_e32m1.bin", C, M * N);
@@ -140,9 +164,224 @@ int main(int argc, char* argv[]) {
     matmul_tiled_e32m8(A, B, C, M, N, K, tilesize, tilesize, tilesize);
     write_matrix_binary("./output_files/c_tiled_e32m8.bin", C, M * N);
 
+	// packed panels
+	matmul_packed_e32m1(A, B, C, M, N, K);
+    write_matrix_binary("./output_files/c_packed_e32m1.bin", C, M * N);
+
+	matmul_packed_e32m2(A, B, C, M, N, K);
+    write_matrix_binary("./output_files/c_packed_e32m2.bin", C, M * N);
+
+	matmul_packed_e32m4(A, B, C, M, N, K);
+    write_matrix_binary("./output_files/c_packed_e32m4.bin", C, M * N);
+
+	const double st_ms = time_ms([&] { matmul_packed_e32m8(A, B, C, M, N, K); });
+    write_matrix_binary("./output_files/c_packed_e32m8.bin", C, M * N);
+
+	// packed panels, B prepacked once outside the timed call
+	PackedWeights* B_packed = pack_weights(B, K, N);
+	const double pp_ms = time_ms([&] { matmul_prepacked(A, B_packed, C, M); });
+    write_matrix_binary("./output_files/c_prepacked_e32m8.bin", C, M * N);
+	free_packed_weights(B_packed);
+
+	// packed panels, multi-threaded
+	matmul_packed_mt_e32m1(A, B, C, M, N, K, num_threads);
+    write_matrix_binary("./output_files/c_packed_mt_e32m1.bin", C, M * N);
+
+	matmul_packed_mt_e32m2(A, B, C, M, N, K, num_threads);
+    write_matrix_binary("./output_files/c_packed_mt_e32m2.bin", C, M * N);
+
+	matmul_packed_mt_e32m4(A, B, C, M, N, K, num_threads);
+    write_matrix_binary("./output_files/c_packed_mt_e32m4.bin", C, M * N);
+
+	const double mt_ms = time_ms([&] { matmul_packed_mt_e32m8(A, B, C, M, N, K, num_threads); });
+    write_matrix_binary("./output_files/c_packed_mt_e32m8.bin", C, M * N);
+
+	// packed panels, split-K
+	matmul_packed_splitk_e32m1(A, B, C, M, N, K, num_threads);
+    write_matrix_binary("./output_files/c_packed_splitk_e32m1.bin", C, M * N);
+
+	matmul_packed_splitk_e32m2(A, B, C, M, N, K, num_threads);
+    write_matrix_binary("./output_files/c_packed_splitk_e32m2.bin", C, M * N);
+
+	matmul_packed_splitk_e32m4(A, B, C, M, N, K, num_threads);
+    write_matrix_binary("./output_files/c_packed_splitk_e32m4.bin", C, M * N);
+
+	const double sk_ms = time_ms([&] { matmul_packed_splitk_e32m8(A, B, C, M, N, K, num_threads); });
+    write_matrix_binary("./output_files/c_packed_splitk_e32m8.bin", C, M * N);
+
+	// packed panels, transposed operands: At = A^T [K x M], Bt = B^T [N x K]
+	float* At = new float[K * M];
+	float* Bt = new float[N * K];
+	for (size_t i = 0; i < M; i++)
+		for (size_t k = 0; k < K; k++) At[k * M + i] = A[i * K + k];
+	for (size_t k = 0; k < K; k++)
+		for (size_t j = 0; j < N; j++) Bt[j * K + k] = B[k * N + j];
+
+	matmul_packed_trans_e32m8(At, B, C, M, N, K, true, false);
+    write_matrix_binary("./output_files/c_packed_ta_e32m8.bin", C, M * N);
+
+	matmul_packed_trans_e32m8(A, Bt, C, M, N, K, false, true);
+    write_matrix_binary("./output_files/c_packed_tb_e32m8.bin", C, M * N);
+
+	matmul_packed_trans_e32m1(At, Bt, C, M, N, K, true, true);
+    write_matrix_binary("./output_files/c_packed_tab_e32m1.bin", C, M * N);
+
+	matmul_packed_trans_e32m2(At, Bt, C, M, N, K, true, true);
+    write_matrix_binary("./output_files/c_packed_tab_e32m2.bin", C, M * N);
+
+	matmul_packed_trans_e32m4(At, Bt, C, M, N, K, true, true);
+    write_matrix_binary("./output_files/c_packed_tab_e32m4.bin", C, M * N);
+
+	matmul_packed_trans_e32m8(At, Bt, C, M, N, K, true, true);
+    write_matrix_binary("./output_files/c_packed_tab_e32m8.bin", C, M * N);
+
+	delete[] At;
+	delete[] Bt;
+
+	// fp16 inputs, fp32 accumulation
+	_Float16* A16 = new _Float16[M * K];
+	_Float16* B16 = new _Float16[K * N];
+	for (size_t i = 0; i < M * K; i++) A16[i] = static_cast<_Float16>(A[i]);
+	for (size_t i = 0; i < K * N; i++) B16[i] = static_cast<_Float16>(B[i]);
+
+	matmul_packed_f16_e16m1(A16, B16, C, M, N, K);
+    write_matrix_binary("./output_files/c_packed_f16_e16m1.bin", C, M * N);
+
+	matmul_packed_f16_e16m2(A16, B16, C, M, N, K);
+    write_matrix_binary("./output_files/c_packed_f16_e16m2.bin", C, M * N);
+
+	const double f16_ms = time_ms([&] { matmul_packed_f16_e16m4(A16, B16, C, M, N, K); });
+    write_matrix_binary("./output_files/c_packed_f16_e16m4.bin", C, M * N);
+
+	delete[] A16;
+	delete[] B16;
+
+	// int8 inputs, int32 accumulation: A quantized per row (scale sa[i], zero point za),
+	// B per tensor (sb, zb); the requantized result uses scale sy and zero point zy
+	const int32_t za = 3, zb = -5, zy = 2;
+	int8_t* A8 = new int8_t[M * K];
+	int8_t* B8 = new int8_t[K * N];
+	int32_t* C32 = new int32_t[M * N];
+	int8_t* Y8 = new int8_t[M * N];
+	int32_t* q_mult = new int32_t[M];
+	int32_t* q_shift = new int32_t[M];
+
+	float max_b = 0.0f, max_c = 0.0f;
+	for (size_t i = 0; i < K * N; i++) max_b = std::max(max_b, fabsf(B[i]));
+	for (size_t i = 0; i < M * N; i++) max_c = std::max(max_c, fabsf(C_scalar[i]));
+	const float sb = max_b > 0.0f ? max_b / 120.0f : 1.0f;
+	const float sy = max_c > 0.0f ? max_c / 120.0f : 1.0f;
+
+	for (size_t k = 0; k < K * N; k++) {
+		B8[k] = static_cast<int8_t>(std::min(127L, std::max(-128L, lrintf(B[k] / sb) + zb)));
+	}
+	for (size_t i = 0; i < M; i++) {
+		float max_a = 0.0f;
+		for (size_t k = 0; k < K; k++) max_a = std::max(max_a, fabsf(A[i * K + k]));
+		const float sa = max_a > 0.0f ? max_a / 120.0f : 1.0f;
+		for (size_t k = 0; k < K; k++) {
+			A8[i * K + k] = static_cast<int8_t>(std::min(127L, std::max(-128L, lrintf(A[i * K + k] / sa) + za)));
+		}
+		quantize_multiplier((double)sa * sb / sy, &q_mult[i], &q_shift[i]);
+	}
+
+    write_matrix_binary("./output_files/A_q8.bin", A8, M * K);
+    write_matrix_binary("./output_files/B_q8.bin", B8, K * N);
+
+	matmul_scalar_s8(A8, B8, C32, M, N, K, za, zb);
+    write_matrix_binary("./output_files/c_scalar_s8.bin", C32, M * N);
+
+	matmul_packed_s8_e8m1(A8, B8, C32, M, N, K, za, zb);
+    write_matrix_binary("./output_files/c_packed_s8_e8m1.bin", C32, M * N);
+
+	const double s8_ms = time_ms([&] { matmul_packed_s8_e8m2(A8, B8, C32, M, N, K, za, zb); });
+    write_matrix_binary("./output_files/c_packed_s8_e8m2.bin", C32, M * N);
+
+	// requantized per channel, written back dequantized: (y - zy) * sy
+	matmul_packed_q8_e8m1(A8, B8, Y8, M, N, K, za, zb, q_mult, q_shift, nullptr, zy, true);
+	for (size_t i = 0; i < M * N; i++) C[i] = (Y8[i] - zy) * sy;
+    write_matrix_binary("./output_files/c_packed_q8_e8m1.bin", C, M * N);
+
+	matmul_packed_q8_e8m2(A8, B8, Y8, M, N, K, za, zb, q_mult, q_shift, nullptr, zy, true);
+	for (size_t i = 0; i < M * N; i++) C[i] = (Y8[i] - zy) * sy;
+    write_matrix_binary("./output_files/c_packed_q8_e8m2.bin", C, M * N);
+
+	delete[] A8;
+	delete[] B8;
+	delete[] C32;
+	delete[] Y8;
+	delete[] q_mult;
+	delete[] q_shift;
+
+	// Strassen-Winograd, with its error against the scalar reference
+	const double sw_ms = time_ms([&] { matmul_strassen_e32m8(A, B, C, M, N, K, strassen_cutoff); });
+    write_matrix_binary("./output_files/c_strassen_e32m8.bin", C, M * N);
+
+	double max_err = 0.0, max_ref = 0.0;
+	for (size_t i = 0; i < M * N; i++) {
+		max_err = std::max(max_err, (double)fabs(C[i] - C_scalar[i]));
+		max_ref = std::max(max_ref, (double)fabs(C_scalar[i]));
+	}
+	cout << "Strassen e32m8 (cutoff " << strassen_cutoff << "): max abs error vs scalar " << max_err
+	     << " (relative " << (max_ref > 0.0 ? max_err / max_ref : 0.0) << ")" << endl;
+
+	// double precision (same inputs widened to f64)
+	double* A64 = new double[M * K];
+	double* B64 = new double[K * N];
+	double* Bt64 = new double[N * K];
+	double* C64 = new double[M * N];
+	for (size_t i = 0; i < M * K; i++) A64[i] = A[i];
+	for (size_t i = 0; i < K * N; i++) B64[i] = B[i];
+	for (size_t k = 0; k < K; k++)
+		for (size_t j = 0; j < N; j++) Bt64[j * K + k] = B64[k * N + j];
+
+	matmul_scalar(A64, B64, C64, M, N, K);
+    write_matrix_binary("./output_files/c_scalar_f64.bin", C64, M * N);
+
+	// BLAS form on top of the scalar result: 2 * A * B^T^T - 1 * C = A * B
+	matmul_gemm<double>(false, true, M, N, K, 2.0, A64, K, Bt64, K, -1.0, C64, N);
+    write_matrix_binary("./output_files/c_gemm_f64.bin", C64, M * N);
+
+	matmul_packed_e64m1(A64, B64, C64, M, N, K);
+    write_matrix_binary("./output_files/c_packed_e64m1.bin", C64, M * N);
+
+	matmul_packed_e64m2(A64, B64, C64, M, N, K);
+    write_matrix_binary("./output_files/c_packed_e64m2.bin", C64, M * N);
+
+	matmul_packed_e64m4(A64, B64, C64, M, N, K);
+    write_matrix_binary("./output_files/c_packed_e64m4.bin", C64, M * N);
+
+	const double f64_ms = time_ms([&] { matmul_packed_e64m8(A64, B64, C64, M, N, K); });
+    write_matrix_binary("./output_files/c_packed_e64m8.bin", C64, M * N);
+
+	matmul<double>(A64, B64, C64, M, N, K);
+    write_matrix_binary("./output_files/c_matmul_f64.bin", C64, M * N);
+
+	delete[] A64;
+	delete[] B64;
+	delete[] Bt64;
+	delete[] C64;
+
+	// Timings, all against the single-threaded packed e32m8 call
+	const size_t in_elems = M * K + K * N;
+	cout << "Packed e32m8: 1 thread " << st_ms << " ms, " << num_threads << " threads " << mt_ms
+	     << " ms (speedup " << st_ms / mt_ms << "x)" << endl;
+	cout << "Packed e32m8 split-K: " << num_threads << " threads " << sk_ms << " ms (speedup "
+	     << st_ms / sk_ms << "x)" << endl;
+	cout << "Prepacked e32m8: " << pp_ms << " ms vs " << st_ms << " ms packing B per call" << endl;
+	cout << "Packed fp16 e16m4 (fp32 acc): " << f16_ms << " ms (speedup " << st_ms / f16_ms << "x, "
+	     << in_elems * sizeof(_Float16) << " vs " << in_elems * sizeof(float) << " input bytes)" << endl;
+	cout << "Packed int8 e8m2 (int32 acc): " << s8_ms << " ms (speedup " << st_ms / s8_ms << "x, "
+	     << in_elems * sizeof(int8_t) << " vs " << in_elems * sizeof(float) << " input bytes)" << endl;
+	cout << "Strassen e32m8 (cutoff " << strassen_cutoff << "): " << sw_ms << " ms (speedup "
+	     << st_ms / sw_ms << "x)" << endl;
+	cout << "Packed e64m8: " << f64_ms << " ms (" << (2.0 * M * N * K / 1e6) / f64_ms
+	     << " MFLOP/ms, " << f64_ms / st_ms << "x the e32m8 time)" << endl;
+
     delete[] A;
     delete[] B;
     delete[] C;
+    delete[] C_scalar;
 
     return 0;
 }
\ No newline at end of file
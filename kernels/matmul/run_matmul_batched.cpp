@@ -0,0 +1,114 @@
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "./include/defs.h"
+#include "rvv_gemm.hpp"
+
+using namespace std;
+
+// "2,1,33,17" -> {2, 1, 33, 17}
+static vector<size_t> parse_shape(const char* arg) {
+    vector<size_t> shape;
+    string s(arg);
+    size_t pos = 0;
+    while (pos <= s.size()) {
+        size_t comma = s.find(',', pos);
+        if (comma == string::npos) comma = s.size();
+        shape.push_back(static_cast<size_t>(atoi(s.substr(pos, comma - pos).c_str())));
+        pos = comma + 1;
+    }
+    return shape;
+}
+
+static size_t numel(const vector<size_t>& shape) {
+    size_t n = 1;
+    for (size_t d : shape) n *= d;
+    return n;
+}
+
+static string shape_str(const size_t* shape, size_t ndim) {
+    string s = "[";
+    for (size_t d = 0; d < ndim; d++) s += (d ? ", " : "") + to_string(shape[d]);
+    return s + "]";
+}
+
+int main(int argc, char* argv[]) {
+    // --- HANDLE ARGUMENTS ---
+    // Format: ./run_matmul_batched A_SHAPE B_SHAPE   e.g. 8,1,33,17 4,17,29
+    vector<size_t> a_shape = {8, 16, 12, 20};
+    vector<size_t> b_shape = {16, 20, 10};
+    if (argc >= 3) {
+        a_shape = parse_shape(argv[1]);
+        b_shape = parse_shape(argv[2]);
+    }
+
+    // Worker count for small items scheduled across harts (GEMM_THREADS environment variable)
+    if (const char* env = getenv("GEMM_THREADS")) {
+        gemm_set_num_threads(atoi(env));
+    }
+
+    size_t c_shape[MATMUL_MAX_DIMS];
+    int c_ndim = matmul_batched_shape(a_shape.data(), a_shape.size(), b_shape.data(), b_shape.size(), c_shape);
+    if (c_ndim < 0) {
+        cerr << "Shapes " << shape_str(a_shape.data(), a_shape.size()) << " and "
+             << shape_str(b_shape.data(), b_shape.size()) << " do not broadcast for MatMul" << endl;
+        return 1;
+    }
+
+    size_t c_size = 1;
+    for (int d = 0; d < c_ndim; d++) c_size *= c_shape[d];
+
+    cout << "A: " << shape_str(a_shape.data(), a_shape.size())
+         << "  B: " << shape_str(b_shape.data(), b_shape.size())
+         << "  ->  C: " << shape_str(c_shape, c_ndim) << endl;
+
+    // --- INITIALIZE TENSORS ---
+    vector<float> A(numel(a_shape)), B(numel(b_shape)), C(c_size);
+    srand(0);
+    for (auto& x : A) x = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+    for (auto& x : B) x = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+
+    write_matrix_binary("./output_files/a_batched.bin", A.data(), A.size());
+    write_matrix_binary("./output_files/b_batched.bin", B.data(), B.size());
+
+    // batched
+    matmul_batched_e32m1(A.data(), a_shape.data(), a_shape.size(), B.data(), b_shape.data(), b_shape.size(), C.data());
+    write_matrix_binary("./output_files/c_batched_e32m1.bin", C.data(), c_size);
+
+    matmul_batched_e32m2(A.data(), a_shape.data(), a_shape.size(), B.data(), b_shape.data(), b_shape.size(), C.data());
+    write_matrix_binary("./output_files/c_batched_e32m2.bin", C.data(), c_size);
+
+    matmul_batched_e32m4(A.data(), a_shape.data(), a_shape.size(), B.data(), b_shape.data(), b_shape.size(), C.data());
+    write_matrix_binary("./output_files/c_batched_e32m4.bin", C.data(), c_size);
+
+    auto t0 = chrono::high_resolution_clock::now();
+    matmul_batched_e32m8(A.data(), a_shape.data(), a_shape.size(), B.data(), b_shape.data(), b_shape.size(), C.data());
+    auto t1 = chrono::high_resolution_clock::now();
+    write_matrix_binary("./output_files/c_batched_e32m8.bin", C.data(), c_size);
+
+    // Same work as a loop of single 2-D calls when both operands carry the full batch
+    if (a_shape.size() >= 3 && a_shape.size() == b_shape.size() && numel(a_shape) / (a_shape[a_shape.size() - 2] * a_shape.back()) ==
+        numel(b_shape) / (b_shape[b_shape.size() - 2] * b_shape.back())) {
+        size_t M = a_shape[a_shape.size() - 2], K = a_shape.back(), N = b_shape.back();
+        size_t batch = c_size / (M * N);
+
+        auto t2 = chrono::high_resolution_clock::now();
+        for (size_t b = 0; b < batch; b++) {
+            matmul_packed_e32m8(A.data() + b * M * K, B.data() + b * K * N, C.data() + b * M * N, M, N, K);
+        }
+        auto t3 = chrono::high_resolution_clock::now();
+
+        chrono::duration<double, milli> batched_ms = t1 - t0;
+        chrono::duration<double, milli> loop_ms = t3 - t2;
+        cout << "e32m8: batched " << batched_ms.count() << " ms, loop of " << batch
+             << " calls " << loop_ms.count() << " ms" << endl;
+
+        matmul_strided_batched_e32m8(A.data(), B.data(), C.data(), batch, M, N, K, M * K, K * N, M * N);
+        write_matrix_binary("./output_files/c_strided_batched_e32m8.bin", C.data(), c_size);
+    }
+
+    return 0;
+}
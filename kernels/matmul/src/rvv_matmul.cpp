@@ -2,7 +2,13 @@
 #include <cstddef>
 #include <cstring>
 #include <algorithm> // Add this for std::min
+#include <vector>
 #include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_strassen.hpp"
+#include "rvv_gemm_mixed.hpp"
+#include "rvv_gemm_int8.hpp"
+#include "defs.h"
 
 using namespace std;
 
@@ -134,8 +140,33 @@ void matmul_e32m8(float *A, float *B, float *C, size_t M, size_t N, size_t K) {
 
 /********************************* Vectorized Unrolled *********************************/
 
+// Remaining rows of the unrolled kernels when M is not a multiple of the unroll factor
+template<int LMUL>
+static void matmul_tail_rows(float *A, float *B, float *C, size_t i_start, size_t M, size_t N, size_t K) {
+	for (size_t i = i_start; i < M; i++) {
+		size_t j_idx = 0;
+		size_t j_left = N;
+		while (j_left > 0) {
+			size_t vl = SET_VECTOR_LENGTH<float, LMUL>(j_left);
+
+			auto v_acc = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+
+			for (size_t k = 0; k < K; k++) {
+				auto v_b = VECTOR_LOAD<float, LMUL>(&B[k * N + j_idx], vl);
+				v_acc = VECTOR_FMACC<float, LMUL>(v_acc, A[i * K + k], v_b, vl);
+			}
+
+			VECTOR_STORE<float, LMUL>(&C[i * N + j_idx], v_acc, vl);
+
+			j_idx += vl;
+			j_left -= vl;
+		}
+	}
+}
+
 void matmul_e32m1_unroll(float *A, float *B, float *C, size_t M, size_t N, size_t K) {
-	for (size_t i = 0; i + 7 < M; i += 8) {
+	size_t i = 0;
+	for (; i + 7 < M; i += 8) {
 		size_t j_idx = 0;
 		size_t j_left = N;
 		while (j_left > 0) {
@@ -180,11 +211,14 @@ void matmul_e32m1_unroll(float *A, float *B, float *C, size_t M, size_t N, size_
 			j_left -= vl;
 		}
 	}
+
+	matmul_tail_rows<M1>(A, B, C, i, M, N, K);
 }
 
 void matmul_e32m2_unroll(float *A, float *B, float *C, size_t M, size_t N, size_t K) {
 	// Process 4 rows of A at a time
-	for (size_t i = 0; i + 3 < M; i += 4) {
+	size_t i = 0;
+	for (; i + 3 < M; i += 4) {
 		size_t j_idx = 0;
 		size_t j_left = N;
 		
@@ -224,10 +258,13 @@ void matmul_e32m2_unroll(float *A, float *B, float *C, size_t M, size_t N, size_
 			j_left -= vl;
 		}
 	}
+
+	matmul_tail_rows<M2>(A, B, C, i, M, N, K);
 }
 
 void matmul_e32m4_unroll(float *A, float *B, float *C, size_t M, size_t N, size_t K) {
-	for (size_t i = 0; i + 3 < M; i += 4) {
+	size_t i = 0;
+	for (; i + 3 < M; i += 4) {
 		size_t j_idx = 0;
 		size_t j_left = N;
 		while (j_left > 0) {
@@ -261,10 +298,13 @@ void matmul_e32m4_unroll(float *A, float *B, float *C, size_t M, size_t N, size_
 			j_left -= vl;
 		}
 	}
+
+	matmul_tail_rows<M4>(A, B, C, i, M, N, K);
 }
 
 void matmul_e32m8_unroll(float *A, float *B, float *C, size_t M, size_t N, size_t K) {
-	for (size_t i = 0; i + 1 < M; i += 2) {
+	size_t i = 0;
+	for (; i + 1 < M; i += 2) {
 		size_t j_idx = 0;
 		size_t j_left = N;
 		while (j_left > 0) {
@@ -290,6 +330,8 @@ void matmul_e32m8_unroll(float *A, float *B, float *C, size_t M, size_t N, size_
 			j_left -= vl;
 		}
 	}
+
+	matmul_tail_rows<M8>(A, B, C, i, M, N, K);
 }
 
 
@@ -621,5 +663,507 @@ void matmul_tiled_e32m8(const float *A, const float *B, float *C,
 	}
 }
 
+/******************************** Packed Panels ********************************/
+
+// A and B are packed into cache-sized panels and C is computed in MR x (VLMAX) register
+// tiles by the shared engine in lib/rvv_gemm.hpp. Edge tiles use a partial vl / row count.
+void matmul_packed_e32m1(const float *A, const float *B, float *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<float, M1>(A, B, C, M, N, K);
+}
+
+void matmul_packed_e32m2(const float *A, const float *B, float *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<float, M2>(A, B, C, M, N, K);
+}
+
+void matmul_packed_e32m4(const float *A, const float *B, float *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<float, M4>(A, B, C, M, N, K);
+}
+
+void matmul_packed_e32m8(const float *A, const float *B, float *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<float, M8>(A, B, C, M, N, K);
+}
+
+/*************************** Packed Panels (multi-hart) ***************************/
+
+// Same engine split over num_threads pthreads: C is partitioned in 2D on MR / NR panel
+// boundaries and each B block is packed once into a buffer shared by all workers.
+void matmul_packed_mt_e32m1(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_mt<float, M1>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+void matmul_packed_mt_e32m2(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_mt<float, M2>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+void matmul_packed_mt_e32m4(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_mt<float, M4>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+void matmul_packed_mt_e32m8(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_mt<float, M8>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+/***************************** Packed Panels (split-K) *****************************/
+
+// Forces the split-K schedule: K is cut into num_threads runs of KC blocks, each multiplied
+// into a private partial C, then summed with vector adds. gemm_packed_strided picks this
+// on its own when K is long and M x N too small to keep the workers busy.
+void matmul_packed_splitk_e32m1(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_splitk<float, M1>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+void matmul_packed_splitk_e32m2(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_splitk<float, M2>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+void matmul_packed_splitk_e32m4(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_splitk<float, M4>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+void matmul_packed_splitk_e32m8(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, int num_threads)
+{
+	gemm_packed_splitk<float, M8>(M, N, K, A, K, 1, B, N, 1, C, N, false, num_threads);
+}
+
+/*************************** Packed Panels (transposed) ***************************/
+
+// op(A) * op(B) with op = transpose when the flag is set: A is then stored [K x M] and
+// B [N x K]. The packers read along the contiguous dimension, so no copy is materialized.
+void matmul_packed_trans_e32m1(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b)
+{
+	gemm_packed_trans<float, M1>(trans_a, trans_b, A, B, C, M, N, K);
+}
+
+void matmul_packed_trans_e32m2(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b)
+{
+	gemm_packed_trans<float, M2>(trans_a, trans_b, A, B, C, M, N, K);
+}
+
+void matmul_packed_trans_e32m4(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b)
+{
+	gemm_packed_trans<float, M4>(trans_a, trans_b, A, B, C, M, N, K);
+}
+
+void matmul_packed_trans_e32m8(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, bool trans_a, bool trans_b)
+{
+	gemm_packed_trans<float, M8>(trans_a, trans_b, A, B, C, M, N, K);
+}
+
+/*************************** Packed Panels (prepacked B) ***************************/
+
+// Constant right-hand operands (weights) are packed into the e32m8 panel layout once;
+// matmul_prepacked then only packs A on each call.
+struct PackedWeights {
+	GemmPackedB<float, M8> b;
+};
+
+PackedWeights* pack_weights(const float *B, size_t K, size_t N)
+{
+	PackedWeights *w = new PackedWeights;
+	gemm_prepack_b<float, M8>(K, N, B, N, 1, w->b);
+	return w;
+}
+
+void free_packed_weights(PackedWeights *w)
+{
+	delete w;
+}
+
+void matmul_prepacked(const float *A, const PackedWeights *B, float *C, size_t M)
+{
+	gemm_prepacked<float, M8>(M, A, B->b.K, 1, B->b, C, B->b.N);
+}
+
+/************************ Packed Panels (fp16 in, fp32 accumulate) ************************/
+
+// _Float16 panels, fp32 accumulators via vfwmacc: half the bytes of the e32 path per tile.
+// The suffix names the fp16 LMUL; the accumulators run at twice that (e16m4 -> e32m8).
+void matmul_packed_f16_e16m1(const _Float16 *A, const _Float16 *B, float *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed_widen<_Float16, float, M1>(A, B, C, M, N, K);
+}
+
+void matmul_packed_f16_e16m2(const _Float16 *A, const _Float16 *B, float *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed_widen<_Float16, float, M2>(A, B, C, M, N, K);
+}
+
+void matmul_packed_f16_e16m4(const _Float16 *A, const _Float16 *B, float *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed_widen<_Float16, float, M4>(A, B, C, M, N, K);
+}
+
+/*********************** Packed Panels (int8 in, int32 accumulate) ***********************/
+
+// Reference for the quantized paths: C = (A - za) * (B - zb) in int32
+void matmul_scalar_s8(const int8_t *A, const int8_t *B, int32_t *C, size_t M, size_t N, size_t K,
+	int32_t za, int32_t zb)
+{
+	for (size_t i = 0; i < M; i++)
+	{
+		for (size_t j = 0; j < N; j++)
+		{
+			int32_t sum = 0;
+			for (size_t k = 0; k < K; k++)
+			{
+				sum += (A[i * K + k] - za) * (B[k * N + j] - zb);
+			}
+			C[i * N + j] = sum;
+		}
+	}
+}
+
+// int8 panels (a quarter of the e32 bytes), int32 accumulators via vsext + vwmacc. The suffix
+// names the int8 LMUL; the accumulators run at four times that (e8m2 -> e32m8).
+void matmul_packed_s8_e8m1(const int8_t *A, const int8_t *B, int32_t *C, size_t M, size_t N, size_t K,
+	int32_t za, int32_t zb)
+{
+	gemm_packed_s8<M1>(M, N, K, A, K, 1, za, B, N, 1, zb, C, N);
+}
+
+void matmul_packed_s8_e8m2(const int8_t *A, const int8_t *B, int32_t *C, size_t M, size_t N, size_t K,
+	int32_t za, int32_t zb)
+{
+	gemm_packed_s8<M2>(M, N, K, A, K, 1, za, B, N, 1, zb, C, N);
+}
+
+// Real requantization scale -> Q31 multiplier and right shift
+void quantize_multiplier(double scale, int32_t *multiplier, int32_t *shift)
+{
+	gemm_quantize_multiplier(scale, *multiplier, *shift);
+}
+
+// Same product requantized to int8 with Q31 multipliers / shifts (one per row of C when
+// per_channel) and an optional int32 bias per row; see gemm_quantize_multiplier.
+void matmul_packed_q8_e8m1(const int8_t *A, const int8_t *B, int8_t *Y, size_t M, size_t N, size_t K,
+	int32_t za, int32_t zb, const int32_t *multiplier, const int32_t *shift, const int32_t *bias,
+	int32_t zy, bool per_channel)
+{
+	GemmRequant rq;
+	rq.multiplier = multiplier;
+	rq.shift = shift;
+	rq.bias = bias;
+	rq.zero_point = zy;
+	rq.per_channel = per_channel;
+	gemm_packed_s8_requant<M1>(M, N, K, A, K, 1, za, B, N, 1, zb, rq, Y, N);
+}
+
+void matmul_packed_q8_e8m2(const int8_t *A, const int8_t *B, int8_t *Y, size_t M, size_t N, size_t K,
+	int32_t za, int32_t zb, const int32_t *multiplier, const int32_t *shift, const int32_t *bias,
+	int32_t zy, bool per_channel)
+{
+	GemmRequant rq;
+	rq.multiplier = multiplier;
+	rq.shift = shift;
+	rq.bias = bias;
+	rq.zero_point = zy;
+	rq.per_channel = per_channel;
+	gemm_packed_s8_requant<M2>(M, N, K, A, K, 1, za, B, N, 1, zb, rq, Y, N);
+}
+
+/******************************* Strassen-Winograd ******************************/
+
+// 7 half-size products per level down to `cutoff`, then the packed engine. Temporaries
+// come from one arena allocated per call. Loses some accuracy against matmul_scalar.
+void matmul_strassen_e32m8(const float *A, const float *B, float *C, size_t M, size_t N, size_t K, size_t cutoff)
+{
+	gemm_strassen<float, M8>(A, B, C, M, N, K, cutoff);
+}
+
+/*********************************** Batched ***********************************/
+
+// Strided batch of row-major products: item b is A + b * stride_a (M x K), B + b * stride_b
+// (K x N) and C + b * stride_c (M x N). A zero stride_a / stride_b broadcasts that operand.
+void matmul_strided_batched_e32m1(const float *A, const float *B, float *C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c)
+{
+	gemm_strided_batched<float, M1>(batch, M, N, K, A, K, 1, stride_a, B, N, 1, stride_b, C, N, stride_c);
+}
+
+void matmul_strided_batched_e32m2(const float *A, const float *B, float *C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c)
+{
+	gemm_strided_batched<float, M2>(batch, M, N, K, A, K, 1, stride_a, B, N, 1, stride_b, C, N, stride_c);
+}
+
+void matmul_strided_batched_e32m4(const float *A, const float *B, float *C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c)
+{
+	gemm_strided_batched<float, M4>(batch, M, N, K, A, K, 1, stride_a, B, N, 1, stride_b, C, N, stride_c);
+}
+
+void matmul_strided_batched_e32m8(const float *A, const float *B, float *C, size_t batch, size_t M, size_t N, size_t K,
+	ptrdiff_t stride_a, ptrdiff_t stride_b, ptrdiff_t stride_c)
+{
+	gemm_strided_batched<float, M8>(batch, M, N, K, A, K, 1, stride_a, B, N, 1, stride_b, C, N, stride_c);
+}
+
+// Leading (batch) dims of an ONNX MatMul after numpy-style broadcasting
+struct MatmulBatchLayout {
+	size_t M, N, K;
+	size_t batch;
+	size_t ndim;
+	size_t dims[MATMUL_MAX_DIMS];
+	ptrdiff_t a_stride[MATMUL_MAX_DIMS];	// 0 where A is broadcast
+	ptrdiff_t b_stride[MATMUL_MAX_DIMS];	// 0 where B is broadcast
+};
+
+static bool matmul_batch_layout(const size_t *a_shape, size_t a_ndim, const size_t *b_shape, size_t b_ndim,
+	MatmulBatchLayout &L)
+{
+	if (a_ndim == 0 || b_ndim == 0 || a_ndim > MATMUL_MAX_DIMS || b_ndim > MATMUL_MAX_DIMS)
+		return false;
+
+	// 1-D A is a row vector [1, K], 1-D B a column vector [K, 1]
+	L.M = (a_ndim == 1) ? 1 : a_shape[a_ndim - 2];
+	L.K = a_shape[a_ndim - 1];
+	size_t k_b = (b_ndim == 1) ? b_shape[0] : b_shape[b_ndim - 2];
+	L.N = (b_ndim == 1) ? 1 : b_shape[b_ndim - 1];
+	if (L.K != k_b)
+		return false;
+
+	size_t a_bdim = (a_ndim > 2) ? a_ndim - 2 : 0;
+	size_t b_bdim = (b_ndim > 2) ? b_ndim - 2 : 0;
+	L.ndim = max(a_bdim, b_bdim);
+	L.batch = 1;
+
+	// Right-aligned broadcast, walking from the innermost batch dim outwards
+	ptrdiff_t a_step = L.M * L.K;
+	ptrdiff_t b_step = L.K * L.N;
+	for (size_t d = 0; d < L.ndim; d++)
+	{
+		size_t out = L.ndim - 1 - d;
+		size_t da = (d < a_bdim) ? a_shape[a_bdim - 1 - d] : 1;
+		size_t db = (d < b_bdim) ? b_shape[b_bdim - 1 - d] : 1;
+		if (da != db && da != 1 && db != 1)
+			return false;
+
+		L.dims[out] = max(da, db);
+		L.a_stride[out] = (da == 1) ? 0 : a_step;
+		L.b_stride[out] = (db == 1) ? 0 : b_step;
+		a_step *= da;
+		b_step *= db;
+		L.batch *= L.dims[out];
+	}
+	return true;
+}
+
+int matmul_batched_shape(const size_t *a_shape, size_t a_ndim, const size_t *b_shape, size_t b_ndim, size_t *c_shape)
+{
+	MatmulBatchLayout L;
+	if (!matmul_batch_layout(a_shape, a_ndim, b_shape, b_ndim, L))
+		return -1;
+
+	int c_ndim = 0;
+	for (size_t d = 0; d < L.ndim; d++)
+		c_shape[c_ndim++] = L.dims[d];
+	if (a_ndim > 1)
+		c_shape[c_ndim++] = L.M;
+	if (b_ndim > 1)
+		c_shape[c_ndim++] = L.N;
+	return c_ndim;
+}
+
+// Flattens the broadcast batch into per-item offsets. When both offset sequences are
+// arithmetic (the usual case: equal batch dims, or one operand fully broadcast) the batch
+// goes to the strided driver, which can merge it into a single GEMM; otherwise to the
+// pointer-array driver.
+template<int LMUL>
+static void matmul_batched_impl(const float *A, const size_t *a_shape, size_t a_ndim,
+	const float *B, const size_t *b_shape, size_t b_ndim, float *C)
+{
+	MatmulBatchLayout L;
+	if (!matmul_batch_layout(a_shape, a_ndim, b_shape, b_ndim, L) || L.batch == 0)
+		return;
+
+	vector<ptrdiff_t> off_a(L.batch), off_b(L.batch);
+	size_t idx[MATMUL_MAX_DIMS] = {0};
+	for (size_t b = 0; b < L.batch; b++)
+	{
+		ptrdiff_t oa = 0, ob = 0;
+		for (size_t d = 0; d < L.ndim; d++)
+		{
+			oa += idx[d] * L.a_stride[d];
+			ob += idx[d] * L.b_stride[d];
+		}
+		off_a[b] = oa;
+		off_b[b] = ob;
+
+		for (size_t d = L.ndim; d-- > 0;)
+		{
+			if (++idx[d] < L.dims[d])
+				break;
+			idx[d] = 0;
+		}
+	}
+
+	ptrdiff_t stride_a = (L.batch > 1) ? off_a[1] : 0;
+	ptrdiff_t stride_b = (L.batch > 1) ? off_b[1] : 0;
+	bool uniform = true;
+	for (size_t b = 0; b < L.batch && uniform; b++)
+		uniform = off_a[b] == (ptrdiff_t)b * stride_a && off_b[b] == (ptrdiff_t)b * stride_b;
+
+	if (uniform)
+	{
+		gemm_strided_batched<float, LMUL>(L.batch, L.M, L.N, L.K, A, L.K, 1, stride_a,
+			B, L.N, 1, stride_b, C, L.N, L.M * L.N);
+		return;
+	}
+
+	vector<const float *> a_ptrs(L.batch), b_ptrs(L.batch);
+	vector<float *> c_ptrs(L.batch);
+	for (size_t b = 0; b < L.batch; b++)
+	{
+		a_ptrs[b] = A + off_a[b];
+		b_ptrs[b] = B + off_b[b];
+		c_ptrs[b] = C + b * L.M * L.N;
+	}
+	gemm_batched<float, LMUL>(L.batch, L.M, L.N, L.K, a_ptrs.data(), L.K, 1,
+		b_ptrs.data(), L.N, 1, c_ptrs.data(), L.N);
+}
+
+// ONNX MatMul on N-d tensors: C must hold the shape given by matmul_batched_shape()
+void matmul_batched_e32m1(const float *A, const size_t *a_shape, size_t a_ndim,
+	const float *B, const size_t *b_shape, size_t b_ndim, float *C)
+{
+	matmul_batched_impl<M1>(A, a_shape, a_ndim, B, b_shape, b_ndim, C);
+}
+
+void matmul_batched_e32m2(const float *A, const size_t *a_shape, size_t a_ndim,
+	const float *B, const size_t *b_shape, size_t b_ndim, float *C)
+{
+	matmul_batched_impl<M2>(A, a_shape, a_ndim, B, b_shape, b_ndim, C);
+}
+
+void matmul_batched_e32m4(const float *A, const size_t *a_shape, size_t a_ndim,
+	const float *B, const size_t *b_shape, size_t b_ndim, float *C)
+{
+	matmul_batched_impl<M4>(A, a_shape, a_ndim, B, b_shape, b_ndim, C);
+}
+
+void matmul_batched_e32m8(const float *A, const size_t *a_shape, size_t a_ndim,
+	const float *B, const size_t *b_shape, size_t b_ndim, float *C)
+{
+	matmul_batched_impl<M8>(A, a_shape, a_ndim, B, b_shape, b_ndim, C);
+}
+
+/****************************** Double precision (f64) ******************************/
+
+void matmul_scalar(const double *A, const double *B, double *C, size_t M, size_t N, size_t K)
+{
+	for (size_t i = 0; i < M; i++)
+	{
+		for (size_t j = 0; j < N; j++)
+		{
+			double sum = 0.0;
+			for (size_t k = 0; k < K; k++)
+			{
+				sum += A[i * K + k] * B[k * N + j];
+			}
+			C[i * N + j] = sum;
+		}
+	}
+}
+
+// Same packed engine as the e32 variants; an e64 register group holds half as many columns
+void matmul_packed_e64m1(const double *A, const double *B, double *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<double, M1>(A, B, C, M, N, K);
+}
+
+void matmul_packed_e64m2(const double *A, const double *B, double *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<double, M2>(A, B, C, M, N, K);
+}
+
+void matmul_packed_e64m4(const double *A, const double *B, double *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<double, M4>(A, B, C, M, N, K);
+}
+
+void matmul_packed_e64m8(const double *A, const double *B, double *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<double, M8>(A, B, C, M, N, K);
+}
+
+/******************************** Templated (BLAS-3) ********************************/
+
+// C = A * B for float or double on the packed engine (LMUL = 8)
+template<typename T>
+void matmul(const T *A, const T *B, T *C, size_t M, size_t N, size_t K)
+{
+	gemm_packed<T, M8>(A, B, C, M, N, K);
+}
+
+// BLAS xGEMM: C = alpha * op(A) * op(B) + beta * C with leading dimensions (row-major).
+// op(A) is M x K (A stored K x M when trans_a), op(B) is K x N (B stored N x K when trans_b).
+template<typename T>
+void matmul_gemm(bool trans_a, bool trans_b, size_t M, size_t N, size_t K,
+	T alpha, const T *A, size_t lda, const T *B, size_t ldb, T beta, T *C, size_t ldc)
+{
+	ptrdiff_t rs_a = trans_a ? 1 : lda, cs_a = trans_a ? lda : 1;
+	ptrdiff_t rs_b = trans_b ? 1 : ldb, cs_b = trans_b ? ldb : 1;
+
+	// beta * C first (beta == 0 never reads C, so NaNs in it are dropped as in BLAS)
+	if (beta != (T)1)
+	{
+		for (size_t i = 0; i < M; i++)
+		{
+			for (size_t j = 0; j < N;)
+			{
+				size_t vl = SET_VECTOR_LENGTH<T, M8>(N - j);
+				if (beta == (T)0)
+				{
+					VECTOR_STORE<T, M8>(C + i * ldc + j, VECTOR_MOVE<T, M8>((T)0, vl), vl);
+				}
+				else
+				{
+					auto v_c = VECTOR_LOAD<T, M8>(C + i * ldc + j, vl);
+					VECTOR_STORE<T, M8>(C + i * ldc + j, VECTOR_MUL<T, M8>(v_c, beta, vl), vl);
+				}
+				j += vl;
+			}
+		}
+	}
+	if (alpha == (T)0 || K == 0)
+		return;
+
+	if (alpha == (T)1)
+	{
+		gemm_packed_strided<T, M8>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, true);
+		return;
+	}
 
+	// General alpha: product into a scratch block, then C += alpha * AB
+	vector<T> AB(M * N);
+	gemm_packed_strided<T, M8>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, AB.data(), N);
+	for (size_t i = 0; i < M; i++)
+	{
+		for (size_t j = 0; j < N;)
+		{
+			size_t vl = SET_VECTOR_LENGTH<T, M8>(N - j);
+			auto v_c = VECTOR_LOAD<T, M8>(C + i * ldc + j, vl);
+			auto v_ab = VECTOR_LOAD<T, M8>(AB.data() + i * N + j, vl);
+			VECTOR_STORE<T, M8>(C + i * ldc + j, VECTOR_FMACC_VF<T, M8>(v_c, alpha, v_ab, vl), vl);
+			j += vl;
+		}
+	}
+}
 
+template void matmul<float>(const float *, const float *, float *, size_t, size_t, size_t);
+template void matmul<double>(const double *, const double *, double *, size_t, size_t, size_t);
+template void matmul_gemm<float>(bool, bool, size_t, size_t, size_t,
+	float, const float *, size_t, const float *, size_t, float, float *, size_t);
+template void matmul_gemm<double>(bool, bool, size_t, size_t, size_t,
+	double, const double *, size_t, const double *, size_t, double, double *, size_t);
@@ -1,5 +1,6 @@
 #include <cstdio>
 #include <cstddef>
+#include <cstdint>
 
 using namespace std;
 
@@ -22,4 +23,28 @@ void write_matrix_binary(const char* filename, float* matrix, size_t count) {
     
     fwrite(matrix, sizeof(float), count, f);
     fclose(f);
+}
+
+void write_matrix_binary(const char* filename, double* matrix, size_t count) {
+    FILE* f = fopen(filename, "wb");
+    if (!f) return; 
+    
+    fwrite(matrix, sizeof(double), count, f);
+    fclose(f);
+}
+
+void write_matrix_binary(const char* filename, int32_t* matrix, size_t count) {
+    FILE* f = fopen(filename, "wb");
+    if (!f) return; 
+    
+    fwrite(matrix, sizeof(int32_t), count, f);
+    fclose(f);
+}
+
+void write_matrix_binary(const char* filename, int8_t* matrix, size_t count) {
+    FILE* f = fopen(filename, "wb");
+    if (!f) return; 
+    
+    fwrite(matrix, sizeof(int8_t), count, f);
+    fclose(f);
 }
\ No newline at end of file
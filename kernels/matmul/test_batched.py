@@ -0,0 +1,65 @@
+import numpy as np
+import onnx
+import onnxruntime as ort
+import sys
+import os
+
+# Paths
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+OUT_DIR = os.path.join(SCRIPT_DIR, "output_files")
+
+# Utils from this module
+from src.onnx_utils import max_abs_error, snr_db
+
+
+def build_matmul_model(a_rank, b_rank):
+    """ONNX MatMul with dynamic dims of the given ranks (N-d broadcasting semantics)."""
+    from onnx import helper, TensorProto
+
+    a = helper.make_tensor_value_info("a", TensorProto.FLOAT, [None] * a_rank)
+    b = helper.make_tensor_value_info("b", TensorProto.FLOAT, [None] * b_rank)
+    c = helper.make_tensor_value_info("c", TensorProto.FLOAT, None)
+
+    node = helper.make_node("MatMul", inputs=["a", "b"], outputs=["c"])
+    graph = helper.make_graph([node], "BatchedMatMulGraph", [a, b], [c])
+    model = helper.make_model(graph, producer_name="batched_matmul", opset_imports=[helper.make_opsetid("", 13)])
+    model.ir_version = 7
+    onnx.checker.check_model(model)
+    return model
+
+
+def parse_shape(arg):
+    return [int(d) for d in arg.split(",")]
+
+
+# --- HANDLE ARGUMENTS ---
+# Format: python test_batched.py A_SHAPE B_SHAPE   (must match run_matmul_batched)
+a_shape, b_shape = [8, 16, 12, 20], [16, 20, 10]
+if len(sys.argv) >= 3:
+    a_shape, b_shape = parse_shape(sys.argv[1]), parse_shape(sys.argv[2])
+
+A = np.fromfile(os.path.join(OUT_DIR, "a_batched.bin"), dtype=np.float32).reshape(a_shape)
+B = np.fromfile(os.path.join(OUT_DIR, "b_batched.bin"), dtype=np.float32).reshape(b_shape)
+
+# ==== ONNX Golden Reference ====
+model = build_matmul_model(len(a_shape), len(b_shape))
+session = ort.InferenceSession(model.SerializeToString())
+c_ref = session.run(None, {"a": A, "b": B})[0]
+
+print(f"\nBatched MatMul: A{list(A.shape)} @ B{list(B.shape)} -> C{list(c_ref.shape)}")
+
+implementations = []
+for name in ["batched_e32m1", "batched_e32m2", "batched_e32m4", "batched_e32m8", "strided_batched_e32m8"]:
+    path = os.path.join(OUT_DIR, f"c_{name}.bin")
+    if name.startswith("strided") and not os.path.exists(path):
+        continue
+    implementations.append((f"C {name}", np.fromfile(path, dtype=np.float32).reshape(c_ref.shape)))
+
+# ==== Results Table ====
+print(f"\n{'Implementation':<28}{'Max Abs Error':<20}{'SNR (dB)':<20}")
+print("-" * 68)
+
+for name, result in implementations:
+    mae = max_abs_error(c_ref, result)
+    snr = snr_db(c_ref, result)
+    print(f"{name:<28}{mae:<20.6g}{snr:<20.6g}")
@@ -71,6 +71,27 @@ void maxpool_rvv_tiled_m8(const float* input, float* output,
 	int pad_h, int pad_w,
 	int tile_h, int tile_w);
 
+// Blocked NCHW[block] layout (per image [C / block][H][W][block], block <= lanes of one
+// register group of the variant)
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block);
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block);
+
+void maxpool_nchwc_e32m1(const float* input, float* output, int batch, int channels,
+	int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+	int pad_h, int pad_w, int block);
+
+void maxpool_nchwc_e32m2(const float* input, float* output, int batch, int channels,
+	int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+	int pad_h, int pad_w, int block);
+
+void maxpool_nchwc_e32m4(const float* input, float* output, int batch, int channels,
+	int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+	int pad_h, int pad_w, int block);
+
+void maxpool_nchwc_e32m8(const float* input, float* output, int batch, int channels,
+	int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+	int pad_h, int pad_w, int block);
+
 void write_matrix_to_file(const char* filename, float* matrix, std::size_t rows, std::size_t cols);
 void write_matrix_binary(const char* filename, float* matrix, std::size_t count);
 
@@ -85,6 +85,8 @@ maxpool_tiled_m2 = safe_load("maxpool_tiled_m2.bin", output_shape)
 maxpool_tiled_m4 = safe_load("maxpool_tiled_m4.bin", output_shape)
 maxpool_tiled_m8 = safe_load("maxpool_tiled_m8.bin", output_shape)
 
+maxpool_nchwc = [safe_load(f"maxpool_nchwc_e32m{m}.bin", output_shape) for m in (1, 2, 4, 8)]
+
 # ==== Results Table ====
 implementations = [
     ("ONNX Golden Ref", onnx_ref),
@@ -97,6 +99,10 @@ implementations = [
     ("C RVV tiled_m2", maxpool_tiled_m2),
     ("C RVV tiled_m4", maxpool_tiled_m4), 
     ("C RVV tiled_m8", maxpool_tiled_m8),
+    ("C RVV NCHW4c e32m1", maxpool_nchwc[0]),
+    ("C RVV NCHW8c e32m2", maxpool_nchwc[1]),
+    ("C RVV NCHW16c e32m4", maxpool_nchwc[2]),
+    ("C RVV NCHW32c e32m8", maxpool_nchwc[3]),
 ]
 
 print(f"\n{'Implementation':<30}{'Max Abs Error':<20}{'SNR (dB)':<20}")
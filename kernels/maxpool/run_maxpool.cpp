@@ -6,6 +6,21 @@
 
 using namespace std;
 
+// N images NCHW <-> NCHW[block], image n of the blocked tensor at n * ceil(C / block) * block * H * W
+static void to_nchwc(const float* src, float* dst, int N, int C, int H, int W, int block) {
+    int cp = (C + block - 1) / block * block;
+    for (int n = 0; n < N; ++n) {
+        nchw_to_nchwc(src + (size_t)n * C * H * W, dst + (size_t)n * cp * H * W, C, H, W, block);
+    }
+}
+
+static void from_nchwc(const float* src, float* dst, int N, int C, int H, int W, int block) {
+    int cp = (C + block - 1) / block * block;
+    for (int n = 0; n < N; ++n) {
+        nchwc_to_nchw(src + (size_t)n * cp * H * W, dst + (size_t)n * C * H * W, C, H, W, block);
+    }
+}
+
 int main(int argc, char* argv[]) {
     // --- SET PARAMS ---
     int N = 16, C = 1, H = 4, W = 4; 
@@ -73,6 +88,37 @@ int main(int argc, char* argv[]) {
 	maxpool_rvv_tiled_m8(in, out_rvv, N, C, H, W, KH, KW, SH, SW, PH, PW, 8, 256);
     write_matrix_binary("./output_files/maxpool_tiled_m8.bin", out_rvv, output_size);
 	
+    // --- EXECUTE RVV, BLOCKED NCHW[c] (block = one register group at VLEN = 128) ---
+    {
+        // Sized for the widest block (32)
+        int cp_max = (C + 31) / 32 * 32;
+        float* in_b = new float[(size_t)N * cp_max * H * W];
+        float* out_b = new float[(size_t)N * cp_max * OH * OW];
+
+        to_nchwc(in, in_b, N, C, H, W, 4);
+        maxpool_nchwc_e32m1(in_b, out_b, N, C, H, W, KH, KW, SH, SW, PH, PW, 4);
+        from_nchwc(out_b, out_rvv, N, C, OH, OW, 4);
+        write_matrix_binary("./output_files/maxpool_nchwc_e32m1.bin", out_rvv, output_size);
+
+        to_nchwc(in, in_b, N, C, H, W, 8);
+        maxpool_nchwc_e32m2(in_b, out_b, N, C, H, W, KH, KW, SH, SW, PH, PW, 8);
+        from_nchwc(out_b, out_rvv, N, C, OH, OW, 8);
+        write_matrix_binary("./output_files/maxpool_nchwc_e32m2.bin", out_rvv, output_size);
+
+        to_nchwc(in, in_b, N, C, H, W, 16);
+        maxpool_nchwc_e32m4(in_b, out_b, N, C, H, W, KH, KW, SH, SW, PH, PW, 16);
+        from_nchwc(out_b, out_rvv, N, C, OH, OW, 16);
+        write_matrix_binary("./output_files/maxpool_nchwc_e32m4.bin", out_rvv, output_size);
+
+        to_nchwc(in, in_b, N, C, H, W, 32);
+        maxpool_nchwc_e32m8(in_b, out_b, N, C, H, W, KH, KW, SH, SW, PH, PW, 32);
+        from_nchwc(out_b, out_rvv, N, C, OH, OW, 32);
+        write_matrix_binary("./output_files/maxpool_nchwc_e32m8.bin", out_rvv, output_size);
+
+        delete[] in_b;
+        delete[] out_b;
+    }
+
     // --- CLEANUP ---
     delete[] in;
     delete[] out_scalar;
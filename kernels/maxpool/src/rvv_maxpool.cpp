@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cfloat>
 #include "rvv_defs.hpp"
+#include "rvv_nchwc.hpp"
 
 #define MIN(a,b) (((a)<(b))?(a):(b))
 #define MAX(a,b) (((a)>(b))?(a):(b))
@@ -488,4 +489,59 @@ void maxpool_rvv_tiled_m8(const float* input, float* output,
     }
 }
 
+/****************************** Blocked NCHW[c] Layout ******************************/
+// Input and output are [batch][C / block][H][W][block] (rvv_nchwc.hpp): every window tap
+// is one unit-stride vector of block channels, whatever the stride.
+
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width, int block) {
+    nchw_to_nchwc<M8>(src, dst, channels, height, width, block);
+}
+
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width, int block) {
+    nchwc_to_nchw<M8>(src, dst, channels, height, width, block);
+}
+
+template<int LMUL>
+static void maxpool_nchwc_impl(const float* input, float* output,
+                               int batch, int channels,
+                               int in_h, int in_w,
+                               int k_h, int k_w,
+                               int stride_h, int stride_w,
+                               int pad_h, int pad_w, int block) {
+
+    int out_h = (in_h + 2 * pad_h - k_h) / stride_h + 1;
+    int out_w = (in_w + 2 * pad_w - k_w) / stride_w + 1;
+    size_t in_size = nchwc_size(channels, in_h, in_w, block);
+    size_t out_size = nchwc_size(channels, out_h, out_w, block);
+
+    for (int b = 0; b < batch; ++b) {
+        maxpool_nchwc<LMUL>(input + b * in_size, output + b * out_size, channels,
+                            in_h, in_w, out_h, out_w, k_h, k_w, stride_h, stride_w, pad_h, pad_w, block);
+    }
+}
+
+void maxpool_nchwc_e32m1(const float* input, float* output, int batch, int channels,
+                         int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+                         int pad_h, int pad_w, int block) {
+    maxpool_nchwc_impl<M1>(input, output, batch, channels, in_h, in_w, k_h, k_w, stride_h, stride_w, pad_h, pad_w, block);
+}
+
+void maxpool_nchwc_e32m2(const float* input, float* output, int batch, int channels,
+                         int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+                         int pad_h, int pad_w, int block) {
+    maxpool_nchwc_impl<M2>(input, output, batch, channels, in_h, in_w, k_h, k_w, stride_h, stride_w, pad_h, pad_w, block);
+}
+
+void maxpool_nchwc_e32m4(const float* input, float* output, int batch, int channels,
+                         int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+                         int pad_h, int pad_w, int block) {
+    maxpool_nchwc_impl<M4>(input, output, batch, channels, in_h, in_w, k_h, k_w, stride_h, stride_w, pad_h, pad_w, block);
+}
+
+void maxpool_nchwc_e32m8(const float* input, float* output, int batch, int channels,
+                         int in_h, int in_w, int k_h, int k_w, int stride_h, int stride_w,
+                         int pad_h, int pad_w, int block) {
+    maxpool_nchwc_impl<M8>(input, output, batch, channels, in_h, in_w, k_h, k_w, stride_h, stride_w, pad_h, pad_w, block);
+}
+
 /********************************* End of File *********************************/
\ No newline at end of file
@@ -0,0 +1,206 @@
+#ifndef RVV_CONV3X3_HPP
+#define RVV_CONV3X3_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <pthread.h>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_conv_gemm.hpp"
+
+/*
+Direct 3x3 convolution, C_in -> C_out (single image, NCHW, float, any stride / padding).
+
+A vector of output columns of one output row is the unit of work, as in conv2d_3x3_m8,
+but CONV3X3_OCB<LMUL> output channels are computed together: each of the 9 taps of every
+input channel is loaded once (unit-stride for stride 1, strided otherwise) and feeds one
+FMA per output channel of the block, so the accumulators stay in registers across all
+input channels and are stored once, after the epilogue.
+
+Padding is handled in the kernel: interior columns load straight from the input, border
+columns gather their taps through conv_gather_row (zeros outside the image), and taps on
+out-of-image rows are skipped. Output-channel blocks are split across the GEMM worker
+threads.
+*/
+
+// Output channels per register block: OCB accumulators plus one loaded tap must fit the
+// 32 vector registers
+template<int LMUL>
+constexpr size_t CONV3X3_OCB = (LMUL == M8) ? 3 : (LMUL == M4) ? 6 : 8;
+
+// OCB output channels oc0 .. of output row oh, columns ow0 .. ow0 + vl. GATHER routes the
+// taps through conv_gather_row (border columns); otherwise they are direct row loads.
+template<int LMUL, size_t OCB, unsigned EP, bool GATHER>
+inline void conv3x3_block(const float* input, const float* weights, float* output,
+                          const ConvGemmShape& s, size_t oc0, size_t oh, size_t ow0, size_t vl,
+                          float* scratch, const GemmEpilogue<float>* ep) {
+    const size_t C = s.in_channels;
+    const size_t in_area = s.in_h * s.in_w;
+    const size_t out_w = s.out_w(), N = s.N();
+    const ptrdiff_t sw = (ptrdiff_t)s.stride_w;
+    const float* w = weights + oc0 * C * 9;
+    static_assert(OCB >= 1 && OCB <= 8, "conv3x3_block supports 1..8 output channels");
+
+    // Only the OCB live accumulators are initialised; the rest are never touched
+    decltype(VECTOR_MOVE<float, LMUL>(0.0f, vl)) acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7;
+    {
+        auto v_zero = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+        acc0 = v_zero;
+        if constexpr (OCB > 1) acc1 = v_zero;
+        if constexpr (OCB > 2) acc2 = v_zero;
+        if constexpr (OCB > 3) acc3 = v_zero;
+        if constexpr (OCB > 4) acc4 = v_zero;
+        if constexpr (OCB > 5) acc5 = v_zero;
+        if constexpr (OCB > 6) acc6 = v_zero;
+        if constexpr (OCB > 7) acc7 = v_zero;
+    }
+
+    for (size_t ic = 0; ic < C; ic++) {
+        const float* im_c = input + ic * in_area;
+
+        for (size_t kh = 0; kh < 3; kh++) {
+            ptrdiff_t ih = (ptrdiff_t)(oh * s.stride_h + kh) - (ptrdiff_t)s.pad_h;
+            if (ih < 0 || ih >= (ptrdiff_t)s.in_h) continue;
+            const float* row = im_c + ih * (ptrdiff_t)s.in_w;
+
+            for (size_t kw = 0; kw < 3; kw++) {
+                ptrdiff_t iw0 = (ptrdiff_t)ow0 * sw - (ptrdiff_t)s.pad_w + (ptrdiff_t)kw;
+                const float* wk = w + ic * 9 + kh * 3 + kw;
+
+                decltype(acc0) v;
+                if constexpr (GATHER) {
+                    conv_gather_row<float, LMUL>(im_c, s, ih, iw0, vl, scratch);
+                    v = VECTOR_LOAD<float, LMUL>(scratch, vl);
+                } else if (sw == 1) {
+                    v = VECTOR_LOAD<float, LMUL>(row + iw0, vl);
+                } else {
+                    v = VECTOR_STRIDED_LOAD<float, LMUL>(row + iw0, sw * sizeof(float), vl);
+                }
+
+                acc0 = VECTOR_FMACC_VF<float, LMUL>(acc0, wk[0], v, vl);
+                if constexpr (OCB > 1) acc1 = VECTOR_FMACC_VF<float, LMUL>(acc1, wk[1 * C * 9], v, vl);
+                if constexpr (OCB > 2) acc2 = VECTOR_FMACC_VF<float, LMUL>(acc2, wk[2 * C * 9], v, vl);
+                if constexpr (OCB > 3) acc3 = VECTOR_FMACC_VF<float, LMUL>(acc3, wk[3 * C * 9], v, vl);
+                if constexpr (OCB > 4) acc4 = VECTOR_FMACC_VF<float, LMUL>(acc4, wk[4 * C * 9], v, vl);
+                if constexpr (OCB > 5) acc5 = VECTOR_FMACC_VF<float, LMUL>(acc5, wk[5 * C * 9], v, vl);
+                if constexpr (OCB > 6) acc6 = VECTOR_FMACC_VF<float, LMUL>(acc6, wk[6 * C * 9], v, vl);
+                if constexpr (OCB > 7) acc7 = VECTOR_FMACC_VF<float, LMUL>(acc7, wk[7 * C * 9], v, vl);
+            }
+        }
+    }
+
+    const size_t col = oh * out_w + ow0;
+    auto store = [&](auto acc, size_t i) {
+        if constexpr (EP != GEMM_EP_NONE) {
+            acc = gemm_epilogue_apply<float, LMUL, EP>(acc, *ep, oc0 + i, col, vl);
+        }
+        VECTOR_STORE<float, LMUL>(output + (oc0 + i) * N + col, acc, vl);
+    };
+    store(acc0, 0);
+    if constexpr (OCB > 1) store(acc1, 1);
+    if constexpr (OCB > 2) store(acc2, 2);
+    if constexpr (OCB > 3) store(acc3, 3);
+    if constexpr (OCB > 4) store(acc4, 4);
+    if constexpr (OCB > 5) store(acc5, 5);
+    if constexpr (OCB > 6) store(acc6, 6);
+    if constexpr (OCB > 7) store(acc7, 7);
+}
+
+// All output rows of nb <= OCB output channels from oc0: the largest instantiated block
+// that fits nb
+template<int LMUL, size_t OCB, unsigned EP>
+inline void conv3x3_channels(const float* input, const float* weights, float* output,
+                             const ConvGemmShape& s, size_t oc0, size_t nb,
+                             float* scratch, const GemmEpilogue<float>* ep) {
+    if constexpr (OCB > 1) {
+        if (nb < OCB) {
+            conv3x3_channels<LMUL, OCB - 1, EP>(input, weights, output, s, oc0, nb, scratch, ep);
+            return;
+        }
+    }
+
+    const size_t VL = SET_VECTOR_LENGTH_MAX<float, LMUL>();
+    const size_t out_h = s.out_h(), out_w = s.out_w();
+    size_t lo, hi;
+    conv_interior_cols(s, lo, hi);
+
+    for (size_t oh = 0; oh < out_h; oh++) {
+        for (size_t ow = 0, vl; ow < lo; ow += vl) {
+            vl = std::min(VL, lo - ow);
+            conv3x3_block<LMUL, OCB, EP, true>(input, weights, output, s, oc0, oh, ow, vl, scratch, ep);
+        }
+        for (size_t ow = lo, vl; ow < hi; ow += vl) {
+            vl = SET_VECTOR_LENGTH<float, LMUL>(hi - ow);
+            conv3x3_block<LMUL, OCB, EP, false>(input, weights, output, s, oc0, oh, ow, vl, nullptr, ep);
+        }
+        for (size_t ow = hi, vl; ow < out_w; ow += vl) {
+            vl = std::min(VL, out_w - ow);
+            conv3x3_block<LMUL, OCB, EP, true>(input, weights, output, s, oc0, oh, ow, vl, scratch, ep);
+        }
+    }
+}
+
+struct Conv3x3ThreadCtx {
+    const float* input;
+    const float* weights;
+    float* output;
+    const ConvGemmShape* s;
+    size_t oc_first, oc_last;
+    const GemmEpilogue<float>* ep;
+};
+
+template<int LMUL, unsigned EP>
+inline void* conv3x3_worker(void* p) {
+    auto* ctx = static_cast<Conv3x3ThreadCtx*>(p);
+    constexpr size_t OCB = CONV3X3_OCB<LMUL>;
+    std::vector<float> scratch(SET_VECTOR_LENGTH_MAX<float, LMUL>());
+
+    for (size_t oc = ctx->oc_first; oc < ctx->oc_last; oc += OCB) {
+        conv3x3_channels<LMUL, OCB, EP>(ctx->input, ctx->weights, ctx->output, *ctx->s, oc,
+                                        std::min(OCB, ctx->oc_last - oc), scratch.data(), ctx->ep);
+    }
+    return nullptr;
+}
+
+// output[OC][out_h][out_w] = conv3x3(input[C][H][W]), weights [OC][C][3][3]. s.kernel_h and
+// s.kernel_w must be 3 and s.dil_h / s.dil_w 1.
+template<int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void conv2d_3x3_direct(const float* input, const float* weights, float* output,
+                              const ConvGemmShape& s, size_t out_channels,
+                              const GemmEpilogue<float>* ep = nullptr) {
+    constexpr size_t OCB = CONV3X3_OCB<LMUL>;
+    if (out_channels == 0 || s.N() == 0) return;
+
+    // Whole register blocks per worker
+    const size_t blocks = (out_channels + OCB - 1) / OCB;
+    int nt = gemm_get_num_threads();
+    if (out_channels * s.N() * s.in_channels * 9 < (size_t)GEMM_MT_MIN_WORK) nt = 1;
+    nt = (int)std::min((size_t)std::max(nt, 1), blocks);
+
+    std::vector<Conv3x3ThreadCtx> ctx(nt);
+    std::vector<pthread_t> threads(nt);
+    std::vector<bool> running(nt, false);
+
+    for (int t = 0; t < nt; t++) {
+        size_t first = std::min(out_channels, blocks * t / nt * OCB);
+        size_t last = std::min(out_channels, blocks * (t + 1) / nt * OCB);
+        ctx[t] = {input, weights, output, &s, first, last, ep};
+    }
+    for (int t = 1; t < nt; t++) {
+        running[t] = pthread_create(&threads[t], nullptr, conv3x3_worker<LMUL, EP>, &ctx[t]) == 0;
+    }
+
+    conv3x3_worker<LMUL, EP>(&ctx[0]);
+    for (int t = 1; t < nt; t++) {
+        if (running[t]) {
+            pthread_join(threads[t], nullptr);
+        } else {
+            conv3x3_worker<LMUL, EP>(&ctx[t]);
+        }
+    }
+}
+
+#endif // RVV_CONV3X3_HPP
@@ -0,0 +1,347 @@
+#ifndef RVV_CONV_GEMM_HPP
+#define RVV_CONV_GEMM_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <pthread.h>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+
+/*
+Implicit-GEMM convolution (single image, NCHW):
+
+    output[M x N] (+)= weights[M x K] * col[K x N]
+    M = out_channels, K = in_channels * KH * KW, N = out_h * out_w
+
+col is the im2col matrix, but it is never materialised: row k = (c, kh, kw) and column
+n = (oh, ow) of col is input[c][oh * stride_h - pad_h + kh * dil_h][ow * stride_w - pad_w + kw * dil_w]
+(zero outside the image). The loop nest and the microkernel are those of the packed GEMM
+engine; only the B packer differs: conv_pack_b gathers each KC x NC block of col straight
+from the input into the NR-column panels, splitting every panel row at output-row
+boundaries and at the left / right padding so that the interior is one unit-stride (or
+strided, for stride_w > 1) vector load and the padding is a vector of zeros.
+
+Peak extra memory is one MC x KC A block and one KC x NC B block per worker, instead of
+the K x N col buffer (27 x 173,056 floats for a 416 x 416 RGB 3x3 layer). The sums are
+formed in the same order as im2col followed by the packed GEMM (2D path, no split-K), so
+the results match it bit for bit.
+
+With more than one worker the N dimension (output pixels) is split into contiguous runs
+of whole NR panels, each worker packing its own A and B blocks.
+
+1x1 convolutions without padding skip the gather: with stride 1 col is the NCHW input
+itself and the whole conv is a plain packed GEMM with the activation as B; strided 1x1
+convs pack each panel row as a strided view of one input channel (conv_pack_b_1x1), with
+no bounds checks or zero fill.
+
+Dilation is part of ConvGemmShape and only changes the addresses the packer gathers from.
+A grouped convolution (conv2d_implicit_gemm_grouped) is a batch of smaller implicit GEMMs,
+one per group, over the same output pixels.
+*/
+
+// Geometry of one convolution (single image)
+struct ConvGemmShape {
+    size_t in_channels, in_h, in_w;
+    size_t kernel_h, kernel_w;
+    size_t stride_h, stride_w;
+    size_t pad_h, pad_w;
+    size_t dil_h = 1, dil_w = 1;
+
+    size_t out_h() const { return (in_h + 2 * pad_h - dil_h * (kernel_h - 1) - 1) / stride_h + 1; }
+    size_t out_w() const { return (in_w + 2 * pad_w - dil_w * (kernel_w - 1) - 1) / stride_w + 1; }
+    size_t K() const { return in_channels * kernel_h * kernel_w; }
+    size_t N() const { return out_h() * out_w(); }
+};
+
+// len consecutive elements of one row of col: input row ih (of one channel), columns
+// iw0, iw0 + stride_w, ... Out-of-image elements are written as zeros.
+template<typename T, int LMUL>
+inline void conv_gather_row(const T* im_c, const ConvGemmShape& s, ptrdiff_t ih, ptrdiff_t iw0,
+                            size_t len, T* dst) {
+    const ptrdiff_t W = (ptrdiff_t)s.in_w;
+    const ptrdiff_t sw = (ptrdiff_t)s.stride_w;
+
+    // Valid outputs i in [lo, hi): 0 <= iw0 + i * sw < W
+    size_t lo = 0, hi = 0;
+    if (ih >= 0 && ih < (ptrdiff_t)s.in_h && iw0 < W) {
+        lo = iw0 >= 0 ? 0 : (size_t)((-iw0 + sw - 1) / sw);
+        hi = std::min(len, (size_t)((W - 1 - iw0) / sw + 1));
+        lo = std::min(lo, hi);
+    }
+
+    if (lo > 0) {
+        VECTOR_STORE<T, LMUL>(dst, VECTOR_MOVE<T, LMUL>(static_cast<T>(0), lo), lo);
+    }
+    if (hi > lo) {
+        const T* src = im_c + ih * W + iw0 + (ptrdiff_t)lo * sw;
+        size_t vl = hi - lo;
+        if (sw == 1) {
+            VECTOR_STORE<T, LMUL>(dst + lo, VECTOR_LOAD<T, LMUL>(src, vl), vl);
+        } else {
+            VECTOR_STORE<T, LMUL>(dst + lo, VECTOR_STRIDED_LOAD<T, LMUL>(src, sw * sizeof(T), vl), vl);
+        }
+    }
+    if (len > hi) {
+        VECTOR_STORE<T, LMUL>(dst + hi, VECTOR_MOVE<T, LMUL>(static_cast<T>(0), len - hi), len - hi);
+    }
+}
+
+// Output columns [lo, hi) whose taps are all inside the image (for direct kernels that
+// load the interior straight from the input and gather only the border columns)
+inline void conv_interior_cols(const ConvGemmShape& s, size_t& lo, size_t& hi) {
+    const size_t out_w = s.out_w();
+    const ptrdiff_t span = (ptrdiff_t)(s.dil_w * (s.kernel_w - 1));
+    const ptrdiff_t last = (ptrdiff_t)s.in_w - 1 + (ptrdiff_t)s.pad_w - span;
+
+    lo = (s.pad_w + s.stride_w - 1) / s.stride_w;
+    hi = last < 0 ? 0 : std::min(out_w, (size_t)(last / (ptrdiff_t)s.stride_w) + 1);
+    lo = std::min(lo, out_w);
+    hi = std::max(hi, lo);
+}
+
+// conv_pack_b for a 1x1 kernel without padding: row k of col is input channel pc + k seen
+// with row stride stride_h * in_w and column stride stride_w, all inside the image
+template<typename T, int LMUL>
+inline void conv_pack_b_1x1(const T* input, const ConvGemmShape& s,
+                            size_t pc, size_t jc, size_t kc, size_t nc, T* Bp) {
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+    const size_t out_w = s.out_w();
+    const ptrdiff_t sw = (ptrdiff_t)s.stride_w;
+    const size_t row_step = s.stride_h * s.in_w;
+
+    for (size_t j = 0; j < nc; j += NR) {
+        size_t nr = std::min(NR, nc - j);
+        T* panel = Bp + j * kc;
+        const size_t oh0 = (jc + j) / out_w;
+        const size_t ow0 = (jc + j) % out_w;
+
+        for (size_t k = 0; k < kc; k++) {
+            const T* im_c = input + (pc + k) * s.in_h * s.in_w;
+            T* dst = panel + k * nr;
+
+            size_t oh = oh0, ow = ow0;
+            for (size_t done = 0; done < nr; oh++, ow = 0) {
+                size_t len = std::min(nr - done, out_w - ow);
+                const T* src = im_c + oh * row_step + ow * sw;
+                if (sw == 1) {
+                    VECTOR_STORE<T, LMUL>(dst + done, VECTOR_LOAD<T, LMUL>(src, len), len);
+                } else {
+                    VECTOR_STORE<T, LMUL>(dst + done, VECTOR_STRIDED_LOAD<T, LMUL>(src, sw * sizeof(T), len), len);
+                }
+                done += len;
+            }
+        }
+    }
+}
+
+// Pack rows [pc, pc + kc) x columns [jc, jc + nc) of col into NR-column panels, in the
+// gemm_pack_b layout [panel][k][col]
+template<typename T, int LMUL>
+inline void conv_pack_b(const T* input, const ConvGemmShape& s,
+                        size_t pc, size_t jc, size_t kc, size_t nc, T* Bp) {
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+    const size_t out_w = s.out_w();
+    const size_t kk_size = s.kernel_h * s.kernel_w;
+
+    if (kk_size == 1 && s.pad_h == 0 && s.pad_w == 0) {
+        conv_pack_b_1x1<T, LMUL>(input, s, pc, jc, kc, nc, Bp);
+        return;
+    }
+
+    for (size_t j = 0; j < nc; j += NR) {
+        size_t nr = std::min(NR, nc - j);
+        T* panel = Bp + j * kc;
+        const size_t oh0 = (jc + j) / out_w;
+        const size_t ow0 = (jc + j) % out_w;
+
+        for (size_t k = 0; k < kc; k++) {
+            const size_t c = (pc + k) / kk_size;
+            const size_t r = (pc + k) % kk_size;
+            const ptrdiff_t kh_off = (ptrdiff_t)((r / s.kernel_w) * s.dil_h) - (ptrdiff_t)s.pad_h;
+            const ptrdiff_t kw_off = (ptrdiff_t)((r % s.kernel_w) * s.dil_w) - (ptrdiff_t)s.pad_w;
+            const T* im_c = input + c * s.in_h * s.in_w;
+            T* dst = panel + k * nr;
+
+            // The panel's columns may wrap over several output rows
+            size_t oh = oh0, ow = ow0;
+            for (size_t done = 0; done < nr; oh++, ow = 0) {
+                size_t len = std::min(nr - done, out_w - ow);
+                conv_gather_row<T, LMUL>(im_c, s, (ptrdiff_t)(oh * s.stride_h) + kh_off,
+                                         (ptrdiff_t)(ow * s.stride_w) + kw_off, len, dst + done);
+                done += len;
+            }
+        }
+    }
+}
+
+// Columns [n_first, n_last) of the output, single-threaded
+template<typename T, int LMUL, unsigned EP>
+inline void conv_gemm_implicit_run(const T* input, const ConvGemmShape& s,
+                                   const T* weights, size_t M, T* output,
+                                   size_t n_first, size_t n_last, bool accumulate,
+                                   const GemmEpilogue<T>* ep, GemmWorkspace<T>& ws) {
+    constexpr size_t MR = GEMM_MR<LMUL>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+    const size_t K = s.K();
+    const size_t N = s.N();
+    if (n_last <= n_first) return;
+
+    const size_t mc_blk = std::min(M, std::max(MR, (size_t)GEMM_MC / MR * MR));
+    const size_t nc_blk = std::min(n_last - n_first, std::max(NR, (size_t)GEMM_NC / NR * NR));
+    const size_t kc_blk = std::min(K, (size_t)GEMM_KC);
+
+    if (ws.a_pack.size() < mc_blk * kc_blk) ws.a_pack.resize(mc_blk * kc_blk);
+    if (ws.b_pack.size() < kc_blk * nc_blk) ws.b_pack.resize(kc_blk * nc_blk);
+
+    for (size_t jc = n_first; jc < n_last; jc += nc_blk) {
+        size_t nc = std::min(nc_blk, n_last - jc);
+
+        for (size_t pc = 0; pc < K; pc += kc_blk) {
+            size_t kc = std::min(kc_blk, K - pc);
+            bool acc = accumulate || pc > 0;
+            const GemmEpilogue<T>* ep_k = (pc + kc == K) ? ep : nullptr;
+
+            conv_pack_b<T, LMUL>(input, s, pc, jc, kc, nc, ws.b_pack.data());
+
+            for (size_t ic = 0; ic < M; ic += mc_blk) {
+                size_t mc = std::min(mc_blk, M - ic);
+
+                gemm_pack_a<T, LMUL>(weights + ic * K + pc, K, 1, mc, kc, ws.a_pack.data());
+                gemm_macrokernel<T, LMUL, EP>(mc, nc, kc, ws.a_pack.data(), ws.b_pack.data(),
+                                              output + ic * N + jc, N, acc, ep_k, ic, jc);
+            }
+        }
+    }
+}
+
+template<typename T>
+struct ConvGemmThreadCtx {
+    const T* input;
+    const ConvGemmShape* s;
+    const T* weights;
+    size_t M;
+    T* output;
+    size_t n_first, n_last;
+    bool accumulate;
+    const GemmEpilogue<T>* ep;
+};
+
+template<typename T, int LMUL, unsigned EP>
+inline void* conv_gemm_implicit_worker(void* p) {
+    auto* ctx = static_cast<ConvGemmThreadCtx<T>*>(p);
+    GemmWorkspace<T> ws;
+    conv_gemm_implicit_run<T, LMUL, EP>(ctx->input, *ctx->s, ctx->weights, ctx->M, ctx->output,
+                                        ctx->n_first, ctx->n_last, ctx->accumulate, ctx->ep, ws);
+    return nullptr;
+}
+
+// output[M x N] (+)= weights[M x K] * col(input), weights row-major [OC][IC][KH][KW]
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void conv2d_implicit_gemm(const T* input, const T* weights, T* output,
+                                 const ConvGemmShape& s, size_t M, bool accumulate = false,
+                                 const GemmEpilogue<T>* ep = nullptr) {
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+    const size_t N = s.N();
+    const size_t K = s.K();
+    if (M == 0 || N == 0 || K == 0) return;
+
+    // 1x1, stride 1, no padding: col is the input, so run the plain GEMM on it (threading
+    // and split-K are then the GEMM engine's)
+    if (s.kernel_h == 1 && s.kernel_w == 1 && s.stride_h == 1 && s.stride_w == 1 &&
+        s.pad_h == 0 && s.pad_w == 0) {
+        gemm_packed_strided<T, LMUL, EP>(M, N, K, weights, K, 1, input, N, 1, output, N, accumulate, ep);
+        return;
+    }
+
+    // Contiguous runs of whole NR panels per worker; the caller takes the first run
+    const size_t n_panels = (N + NR - 1) / NR;
+    int nt = gemm_get_num_threads();
+    if (M * N * K < (size_t)GEMM_MT_MIN_WORK) nt = 1;
+    nt = (int)std::min((size_t)std::max(nt, 1), n_panels);
+
+    if (nt == 1) {
+        GemmWorkspace<T> ws;
+        conv_gemm_implicit_run<T, LMUL, EP>(input, s, weights, M, output, 0, N, accumulate, ep, ws);
+        return;
+    }
+
+    std::vector<ConvGemmThreadCtx<T>> ctx(nt);
+    std::vector<pthread_t> threads(nt);
+    std::vector<bool> running(nt, false);
+
+    for (int t = 0; t < nt; t++) {
+        size_t first = std::min(N, n_panels * t / nt * NR);
+        size_t last = std::min(N, n_panels * (t + 1) / nt * NR);
+        ctx[t] = {input, &s, weights, M, output, first, last, accumulate, ep};
+    }
+    for (int t = 1; t < nt; t++) {
+        running[t] = pthread_create(&threads[t], nullptr, conv_gemm_implicit_worker<T, LMUL, EP>, &ctx[t]) == 0;
+    }
+
+    conv_gemm_implicit_worker<T, LMUL, EP>(&ctx[0]);
+    for (int t = 1; t < nt; t++) {
+        if (running[t]) {
+            pthread_join(threads[t], nullptr);
+        } else {
+            conv_gemm_implicit_worker<T, LMUL, EP>(&ctx[t]);
+        }
+    }
+}
+
+// Grouped convolution: s.in_channels and M split into `groups` equal slices, weights
+// [M][in_channels / groups][KH][KW]. Group g is the implicit GEMM of its own input and
+// weight slices into output rows g * M / groups ..; the per-channel epilogue operands
+// (and the residual rows) are offset to those rows.
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void conv2d_implicit_gemm_grouped(const T* input, const T* weights, T* output,
+                                         const ConvGemmShape& s, size_t M, size_t groups,
+                                         bool accumulate = false, const GemmEpilogue<T>* ep = nullptr) {
+    if (groups <= 1) {
+        conv2d_implicit_gemm<T, LMUL, EP>(input, weights, output, s, M, accumulate, ep);
+        return;
+    }
+
+    ConvGemmShape gs = s;
+    gs.in_channels = s.in_channels / groups;
+    const size_t Mg = M / groups;
+    const size_t N = s.N();
+    const size_t in_area = s.in_h * s.in_w;
+
+    for (size_t g = 0; g < groups; g++) {
+        GemmEpilogue<T> ep_g;
+        if (ep) {
+            ep_g = *ep;
+            if (ep_g.bias) ep_g.bias += g * Mg;
+            if (ep_g.scale) ep_g.scale += g * Mg;
+            if (ep_g.shift) ep_g.shift += g * Mg;
+            if (ep_g.residual) ep_g.residual += (ptrdiff_t)(g * Mg) * ep_g.ld_residual;
+        }
+        conv2d_implicit_gemm<T, LMUL, EP>(input + g * gs.in_channels * in_area, weights + g * Mg * gs.K(),
+                                          output + g * Mg * N, gs, Mg, accumulate, ep ? &ep_g : nullptr);
+    }
+}
+
+// Runtime pick among the compiled epilogues (ops is a GEMM_EP_* mask), as gemm_packed_strided_ep
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE, unsigned BIT = GEMM_EP_BIAS>
+inline void conv2d_implicit_gemm_ep(unsigned ops, const T* input, const T* weights, T* output,
+                                    const ConvGemmShape& s, size_t M, const GemmEpilogue<T>& ep,
+                                    bool accumulate = false, size_t groups = 1) {
+    constexpr unsigned ACT = GEMM_EP_RELU | GEMM_EP_LEAKY_RELU | GEMM_EP_CLIP;
+
+    if constexpr (BIT > GEMM_EP_CLIP) {
+        conv2d_implicit_gemm_grouped<T, LMUL, EP>(input, weights, output, s, M, groups, accumulate, &ep);
+    } else if constexpr ((BIT & ACT) != 0 && (EP & ACT) != 0) {
+        conv2d_implicit_gemm_ep<T, LMUL, EP, (BIT << 1)>(ops, input, weights, output, s, M, ep, accumulate, groups);
+    } else {
+        if (ops & BIT) {
+            conv2d_implicit_gemm_ep<T, LMUL, (EP | BIT), (BIT << 1)>(ops, input, weights, output, s, M, ep, accumulate, groups);
+        } else {
+            conv2d_implicit_gemm_ep<T, LMUL, EP, (BIT << 1)>(ops, input, weights, output, s, M, ep, accumulate, groups);
+        }
+    }
+}
+
+#endif // RVV_CONV_GEMM_HPP
@@ -10,6 +10,7 @@
 #include "rvv_arithmetic.hpp"
 #include "rvv_int_comparison.hpp"
 #include "rvv_slidedown.hpp"
+#include "rvv_slideup.hpp"
 #include "rvv_count_pop.hpp"
 #include "rvv_vid.hpp"
 #include "rvv_compress.hpp"
@@ -18,6 +19,7 @@
 #include "rvv_mask_ops.hpp"
 #include "rvv_indexed_load.hpp"
 #include "rvv_vector_narrow.hpp"
+#include "rvv_vector_widen.hpp"
 #include "rvv_vfredsum.hpp"
 
 #endif // RVV_DEFS_HPP
@@ -0,0 +1,78 @@
+#ifndef RVV_DENSE_HPP
+#define RVV_DENSE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_gemv.hpp"
+
+/*
+Batched dense layer (float): output[batch x OUT] = input[batch x IN] * weights^T + bias,
+weights stored [OUT x IN].
+
+Small batches run one GEMV per sample (gemv_n). From DENSE_GEMM_MIN_BATCH samples on, the
+whole batch is a single GEMM (M = batch): each weight panel is packed once and reused by
+every sample in the register tile, so the weights are streamed once per batch, not per
+sample.
+
+The cutoff is a traffic estimate, not a measurement: B GEMVs read the weights B times,
+the GEMM reads them about three times (pack read + write, then the packed panels).
+Below 3 samples the GEMVs move less data; 4 leaves a margin for the packing overhead.
+Tune with -DDENSE_GEMM_MIN_BATCH once timed on the target.
+
+The weights are constant, so their panel layout (B = weights^T) can be built once, at
+model load (dense_prepack). dense_prepacked runs the batch as one GEMM on those panels:
+against the GEMM path of dense_batched it skips the pack read + write of the weights on
+every call, so they are read once per batch and the GEMM pays off from 2 samples on.
+*/
+
+#ifndef DENSE_GEMM_MIN_BATCH
+#define DENSE_GEMM_MIN_BATCH 4
+#endif
+
+template<int LMUL>
+inline void dense_batched(const float* input, const float* weights, const float* bias,
+                          float* output, size_t batch, size_t in_features, size_t out_features) {
+    const size_t K = in_features;
+    const size_t N = out_features;
+
+    // output[b] = bias
+    for (size_t b = 0; b < batch; b++) {
+        std::memcpy(output + b * N, bias, N * sizeof(float));
+    }
+
+    if (batch < DENSE_GEMM_MIN_BATCH) {
+        for (size_t b = 0; b < batch; b++) {
+            gemv_n<float, LMUL>(N, K, weights, K, input + b * K, output + b * N, true);
+        }
+    } else {
+        // output += input * weights^T
+        gemm_packed_strided<float, LMUL>(batch, N, K, input, K, 1, weights, 1, K, output, N, true);
+    }
+}
+
+// [OUT x IN] weights packed as the B operand (weights^T) of dense_prepacked
+template<int LMUL>
+inline void dense_prepack(const float* weights, size_t in_features, size_t out_features,
+                          GemmPackedB<float, LMUL>& pw) {
+    gemm_prepack_b<float, LMUL>(in_features, out_features, weights, 1, in_features, pw);
+}
+
+template<int LMUL>
+inline void dense_prepacked(const float* input, const GemmPackedB<float, LMUL>& pw, const float* bias,
+                            float* output, size_t batch) {
+    const size_t N = pw.N;
+
+    // output[b] = bias
+    for (size_t b = 0; b < batch; b++) {
+        std::memcpy(output + b * N, bias, N * sizeof(float));
+    }
+
+    // output += input * weights^T, B packing skipped
+    gemm_prepacked<float, LMUL>(batch, input, pw.K, 1, pw, output, N, true);
+}
+
+#endif // RVV_DENSE_HPP
@@ -0,0 +1,219 @@
+#ifndef RVV_DEPTHWISE_HPP
+#define RVV_DEPTHWISE_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <pthread.h>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_conv_gemm.hpp"
+
+/*
+Depthwise convolution (single image, NCHW, float): group = in_channels, and output channel
+oc = c * multiplier + j filters input channel c alone with weights[oc][0][KH][KW].
+
+Each output row is computed as in conv2d_3x3_m8: a vector of output columns is one
+accumulator, and every tap (kh, kw) adds k[kh][kw] times a row vector of the input (a
+unit-stride load for stride 1, a strided load for stride 2). Padding is handled in the
+kernel, not by a padded copy of the input. The interior columns, where every tap of the
+row is inside the image, load straight from the input. The few border columns on each side
+gather their taps through conv_gather_row, which writes zeros for out-of-image elements.
+Taps on out-of-image rows are skipped.
+
+The epilogue is the GEMM engine's (gemm_epilogue_apply with row = output channel), so
+bias, folded BN, residual and the activation are applied before the store.
+
+depthwise_pointwise_conv2d fuses a depthwise conv with the following 1x1 conv. The
+depthwise output is produced in bands of output rows, each at most DW_PW_TILE floats for
+all channels, and each band is the B operand of the pointwise GEMM while it is still in
+cache. The full depthwise activation map is never written. The pointwise weights are the
+A operand of every band, so they are packed once (gemm_prepack_a), and the channels of a
+band are split across workers like those of depthwise_conv2d.
+*/
+
+// Floats of depthwise output kept per band in depthwise_pointwise_conv2d
+#ifndef DW_PW_TILE
+#define DW_PW_TILE (32 * 1024)
+#endif
+
+// vl output columns ow0 .. of output row oh of one channel. GATHER routes every tap through
+// conv_gather_row (border columns); otherwise the taps are direct row loads.
+template<int LMUL, unsigned EP, bool GATHER>
+inline void depthwise_row_chunk(const float* in_c, const float* k, float* out_row,
+                                const ConvGemmShape& s, size_t oh, size_t ow0, size_t vl,
+                                float* scratch, size_t oc, const GemmEpilogue<float>* ep) {
+    const ptrdiff_t sw = (ptrdiff_t)s.stride_w;
+    auto acc = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+
+    for (size_t kh = 0; kh < s.kernel_h; kh++) {
+        ptrdiff_t ih = (ptrdiff_t)(oh * s.stride_h + kh * s.dil_h) - (ptrdiff_t)s.pad_h;
+        if (ih < 0 || ih >= (ptrdiff_t)s.in_h) continue;
+        const float* row = in_c + ih * (ptrdiff_t)s.in_w;
+
+        for (size_t kw = 0; kw < s.kernel_w; kw++) {
+            ptrdiff_t iw0 = (ptrdiff_t)ow0 * sw - (ptrdiff_t)s.pad_w + (ptrdiff_t)(kw * s.dil_w);
+            const float kv = k[kh * s.kernel_w + kw];
+
+            if constexpr (GATHER) {
+                conv_gather_row<float, LMUL>(in_c, s, ih, iw0, vl, scratch);
+                acc = VECTOR_FMACC_VF<float, LMUL>(acc, kv, VECTOR_LOAD<float, LMUL>(scratch, vl), vl);
+            } else if (sw == 1) {
+                acc = VECTOR_FMACC_VF<float, LMUL>(acc, kv, VECTOR_LOAD<float, LMUL>(row + iw0, vl), vl);
+            } else {
+                auto v = VECTOR_STRIDED_LOAD<float, LMUL>(row + iw0, sw * sizeof(float), vl);
+                acc = VECTOR_FMACC_VF<float, LMUL>(acc, kv, v, vl);
+            }
+        }
+    }
+
+    if constexpr (EP != GEMM_EP_NONE) {
+        acc = gemm_epilogue_apply<float, LMUL, EP>(acc, *ep, oc, oh * s.out_w() + ow0, vl);
+    }
+    VECTOR_STORE<float, LMUL>(out_row + ow0, acc, vl);
+}
+
+// Output rows [oh_first, oh_last) of output channel oc, written at out_c + (oh - oh_first) * out_w.
+// scratch holds SET_VECTOR_LENGTH_MAX<float, LMUL>() floats for the border gathers.
+template<int LMUL, unsigned EP>
+inline void depthwise_channel_rows(const float* in_c, const float* k, float* out_c,
+                                   const ConvGemmShape& s, size_t oc, size_t oh_first, size_t oh_last,
+                                   float* scratch, const GemmEpilogue<float>* ep) {
+    const size_t VL = SET_VECTOR_LENGTH_MAX<float, LMUL>();
+    const size_t out_w = s.out_w();
+
+    size_t lo, hi;
+    conv_interior_cols(s, lo, hi);
+
+    for (size_t oh = oh_first; oh < oh_last; oh++) {
+        float* out_row = out_c + (oh - oh_first) * out_w;
+
+        for (size_t ow = 0, vl; ow < lo; ow += vl) {
+            vl = std::min(VL, lo - ow);
+            depthwise_row_chunk<LMUL, EP, true>(in_c, k, out_row, s, oh, ow, vl, scratch, oc, ep);
+        }
+        for (size_t ow = lo, vl; ow < hi; ow += vl) {
+            vl = SET_VECTOR_LENGTH<float, LMUL>(hi - ow);
+            depthwise_row_chunk<LMUL, EP, false>(in_c, k, out_row, s, oh, ow, vl, nullptr, oc, ep);
+        }
+        for (size_t ow = hi, vl; ow < out_w; ow += vl) {
+            vl = std::min(VL, out_w - ow);
+            depthwise_row_chunk<LMUL, EP, true>(in_c, k, out_row, s, oh, ow, vl, scratch, oc, ep);
+        }
+    }
+}
+
+struct DepthwiseThreadCtx {
+    const float* input;
+    const float* weights;
+    float* output;
+    const ConvGemmShape* s;
+    size_t multiplier;
+    size_t oc_first, oc_last;
+    size_t oh_first, oh_last;
+    size_t out_stride;
+    const GemmEpilogue<float>* ep;
+};
+
+template<int LMUL, unsigned EP>
+inline void* depthwise_conv2d_worker(void* p) {
+    auto* ctx = static_cast<DepthwiseThreadCtx*>(p);
+    const ConvGemmShape& s = *ctx->s;
+    const size_t in_area = s.in_h * s.in_w;
+    const size_t kk = s.kernel_h * s.kernel_w;
+    std::vector<float> scratch(SET_VECTOR_LENGTH_MAX<float, LMUL>());
+
+    for (size_t oc = ctx->oc_first; oc < ctx->oc_last; oc++) {
+        depthwise_channel_rows<LMUL, EP>(ctx->input + (oc / ctx->multiplier) * in_area, ctx->weights + oc * kk,
+                                         ctx->output + oc * ctx->out_stride, s, oc,
+                                         ctx->oh_first, ctx->oh_last, scratch.data(), ctx->ep);
+    }
+    return nullptr;
+}
+
+// Output rows [oh_first, oh_last) of every channel, channel oc written at output + oc * out_stride.
+// Output channels are split across gemm_get_num_threads() workers.
+template<int LMUL, unsigned EP>
+inline void depthwise_conv2d_rows(const float* input, const float* weights, float* output,
+                                  const ConvGemmShape& s, size_t multiplier,
+                                  size_t oh_first, size_t oh_last, size_t out_stride,
+                                  const GemmEpilogue<float>* ep) {
+    const size_t M = s.in_channels * multiplier;
+    const size_t n = (oh_last - oh_first) * s.out_w();
+    if (M == 0 || n == 0) return;
+
+    int nt = gemm_get_num_threads();
+    if (M * n * s.kernel_h * s.kernel_w < (size_t)GEMM_MT_MIN_WORK) nt = 1;
+    nt = (int)std::min((size_t)std::max(nt, 1), M);
+
+    std::vector<DepthwiseThreadCtx> ctx(nt);
+    std::vector<pthread_t> threads(nt);
+    std::vector<bool> running(nt, false);
+
+    for (int t = 0; t < nt; t++) {
+        ctx[t] = {input, weights, output, &s, multiplier, M * t / nt, M * (t + 1) / nt,
+                  oh_first, oh_last, out_stride, ep};
+    }
+    for (int t = 1; t < nt; t++) {
+        running[t] = pthread_create(&threads[t], nullptr, depthwise_conv2d_worker<LMUL, EP>, &ctx[t]) == 0;
+    }
+
+    depthwise_conv2d_worker<LMUL, EP>(&ctx[0]);
+    for (int t = 1; t < nt; t++) {
+        if (running[t]) {
+            pthread_join(threads[t], nullptr);
+        } else {
+            depthwise_conv2d_worker<LMUL, EP>(&ctx[t]);
+        }
+    }
+}
+
+// output[C * multiplier][out_h][out_w] = depthwise(input[C][H][W]), weights [C * multiplier][KH][KW].
+// s.in_channels is C. Output channels are split across gemm_get_num_threads() workers.
+template<int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void depthwise_conv2d(const float* input, const float* weights, float* output,
+                             const ConvGemmShape& s, size_t multiplier = 1,
+                             const GemmEpilogue<float>* ep = nullptr) {
+    depthwise_conv2d_rows<LMUL, EP>(input, weights, output, s, multiplier, 0, s.out_h(), s.N(), ep);
+}
+
+// Depthwise conv (epilogue EP_DW) followed by a 1x1 conv (epilogue EP_PW):
+//   dw[C * multiplier][N] = depthwise(input),  output[OC][N] = pw_weights[OC][C * multiplier] * dw
+// computed band by band of output rows; the pointwise residual, if any, is [OC][N].
+template<int LMUL, unsigned EP_DW = GEMM_EP_NONE, unsigned EP_PW = GEMM_EP_NONE>
+inline void depthwise_pointwise_conv2d(const float* input, const float* dw_weights, const float* pw_weights,
+                                       float* output, const ConvGemmShape& s, size_t multiplier,
+                                       size_t out_channels,
+                                       const GemmEpilogue<float>* ep_dw = nullptr,
+                                       const GemmEpilogue<float>* ep_pw = nullptr) {
+    const size_t C = s.in_channels * multiplier;
+    const size_t out_h = s.out_h(), out_w = s.out_w(), N = s.N();
+    if (C == 0 || N == 0 || out_channels == 0) return;
+
+    const size_t band_rows = std::max((size_t)1, std::min(out_h, (size_t)DW_PW_TILE / (C * out_w)));
+    std::vector<float> tile(C * band_rows * out_w);
+
+    GemmPackedA<float, LMUL> pw;
+    gemm_prepack_a<float, LMUL>(out_channels, C, pw_weights, C, 1, pw);
+
+    for (size_t oh0 = 0; oh0 < out_h; oh0 += band_rows) {
+        const size_t rows = std::min(band_rows, out_h - oh0);
+        const size_t n0 = oh0 * out_w, nb = rows * out_w;
+
+        // Depthwise band: tile[C][nb]. Its residual / column index is that of the full map.
+        depthwise_conv2d_rows<LMUL, EP_DW>(input, dw_weights, tile.data(), s, multiplier,
+                                           oh0, oh0 + rows, nb, ep_dw);
+
+        // Pointwise: output[:, n0 .. n0 + nb) = pw_weights * tile
+        GemmEpilogue<float> ep_band;
+        if (ep_pw) {
+            ep_band = *ep_pw;
+            if (ep_band.residual) ep_band.residual += n0;
+        }
+        gemm_prepacked_a<float, LMUL, EP_PW>(pw, nb, tile.data(), nb, 1, output + n0, N, false, &ep_band);
+    }
+}
+
+#endif // RVV_DEPTHWISE_HPP
@@ -0,0 +1,1031 @@
+#ifndef RVV_GEMM_HPP
+#define RVV_GEMM_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <pthread.h>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+
+/*
+Packed-panel GEMM engine:  C[M x N] (+)= A[M x K] * B[K x N]
+
+Every operand is described by a base pointer and a row / column stride (in elements), so
+sub-matrices and transposed views (e.g. dense weights stored as [OUT x IN]) are consumed
+without an extra copy. The packers read transposed operands along their contiguous
+dimension and transpose while writing the (cache-resident) panel, so neither packing nor
+the microkernel issues strided loads for row- or column-major inputs. The loop nest
+follows the classic three-level blocking:
+
+    for jc in [0, N) step NC          B block [KC x NC] is packed into NR-wide column panels
+      for pc in [0, K) step KC
+        for ic in [0, M) step MC      A block [MC x KC] is packed into MR-tall row panels
+          for jr in [0, NC) step NR
+            for ir in [0, MC) step MR     microkernel: MR x NR tile of C held in registers
+
+NR is one register group (VLMAX for the chosen LMUL) and MR is chosen so that the MR
+accumulators plus one group of B fit in the 32 vector registers. Edge tiles run the same
+microkernel with a partial vl for the columns and a smaller row count for the rows, so no
+element is ever padded or dropped. Panels are stored compactly: a panel of r rows (or c
+columns) has a k-stride of r (or c).
+
+With more than one thread (gemm_set_num_threads / GEMM_NUM_THREADS) the M x N space of C
+is split over a tm x tn grid of workers on MR / NR panel boundaries. Each B block is packed
+once, cooperatively, into a shared buffer that all workers then read; every worker packs
+its own A rows. Two barriers per K block separate packing from use, so C is never written
+by two threads and the result is bit-identical to the single-threaded path.
+
+When M x N has fewer MR x NR tiles than workers but K is long (small-M dense layers,
+reductions over K much larger than M * N), the grid would leave workers idle, so K is
+split instead: each worker multiplies one run of KC blocks into a private M x N buffer
+(the first writes C directly) and the partial products are summed with vector adds.
+Split-K changes the summation order, so it is not bit-identical to the 2D path.
+
+Operands that never change (layer weights) can be packed once with gemm_prepack_b into a
+GemmPackedB holding every KC x NC block in panel layout; gemm_prepacked then runs the same
+loop nest with the B packing step (and its barriers) skipped. Weights on the A side (conv
+filters, whose activations are the B operand) are packed once the same way with
+gemm_prepack_a into a GemmPackedA and multiplied with gemm_prepacked_a.
+
+An epilogue (bias, per-row scale / shift, residual add, ReLU / LeakyReLU / clip) can be
+selected at compile time with the EP template flags. It is applied to the accumulator
+tile in registers on the last K block, right before the store, so a fused layer writes
+its output once instead of re-reading C for every elementwise op.
+*/
+
+// Cache blocking (elements). MC is rounded down to a multiple of MR, NC to a multiple of NR.
+#ifndef GEMM_MC
+#define GEMM_MC 64
+#endif
+
+#ifndef GEMM_KC
+#define GEMM_KC 128
+#endif
+
+#ifndef GEMM_NC
+#define GEMM_NC 512
+#endif
+
+// Default worker count (1 = single-threaded) and the M*N*K below which threading is skipped
+#ifndef GEMM_NUM_THREADS
+#define GEMM_NUM_THREADS 1
+#endif
+
+#ifndef GEMM_MT_MIN_WORK
+#define GEMM_MT_MIN_WORK (64 * 64 * 64)
+#endif
+
+// Split-K is picked when K >= GEMM_SPLITK_RATIO * M * N (or the M x N grid cannot keep
+// every worker busy) and K spans at least two KC blocks
+#ifndef GEMM_SPLITK_RATIO
+#define GEMM_SPLITK_RATIO 4
+#endif
+
+inline int gemm_num_threads = GEMM_NUM_THREADS;
+
+inline void gemm_set_num_threads(int num_threads) {
+    gemm_num_threads = num_threads < 1 ? 1 : num_threads;
+}
+
+inline int gemm_get_num_threads() {
+    return gemm_num_threads;
+}
+
+// Epilogue flags (combine with |). Applied in this order: bias, scale / shift, residual,
+// then at most one activation.
+enum : unsigned {
+    GEMM_EP_NONE        = 0,
+    GEMM_EP_BIAS        = 1u << 0,  // C[i][j] += bias[i]
+    GEMM_EP_SCALE_SHIFT = 1u << 1,  // C[i][j] = C[i][j] * scale[i] + shift[i]  (folded BN)
+    GEMM_EP_RESIDUAL    = 1u << 2,  // C[i][j] += residual[i * ld_residual + j]
+    GEMM_EP_RELU        = 1u << 3,  // max(C, 0)
+    GEMM_EP_LEAKY_RELU  = 1u << 4,  // C < 0 ? alpha * C : C
+    GEMM_EP_CLIP        = 1u << 5,  // min(max(C, clip_min), clip_max)
+};
+
+// Runtime operands of the epilogue; only the fields named by the EP flags are read.
+// Rows / columns are those of the full C passed to the driver.
+template<typename T>
+struct GemmEpilogue {
+    const T* bias = nullptr;
+    const T* scale = nullptr;
+    const T* shift = nullptr;
+    const T* residual = nullptr;
+    ptrdiff_t ld_residual = 0;
+    T alpha = 0;
+    T clip_min = 0;
+    T clip_max = 0;
+};
+
+// Epilogue on one row segment of the accumulator tile (row, col .. col + vl)
+template<typename T, int LMUL, unsigned EP, typename VecType>
+inline VecType gemm_epilogue_apply(VecType v, const GemmEpilogue<T>& ep, size_t row, size_t col, size_t vl) {
+    static_assert(((EP & GEMM_EP_RELU) != 0) + ((EP & GEMM_EP_LEAKY_RELU) != 0) + ((EP & GEMM_EP_CLIP) != 0) <= 1,
+                  "at most one activation per epilogue");
+
+    if constexpr ((EP & GEMM_EP_BIAS) != 0) {
+        v = VECTOR_ADD<T, LMUL>(v, ep.bias[row], vl);
+    }
+    if constexpr ((EP & GEMM_EP_SCALE_SHIFT) != 0) {
+        v = VECTOR_FMADD_VF<T, LMUL>(v, ep.scale[row], VECTOR_MOVE<T, LMUL>(ep.shift[row], vl), vl);
+    }
+    if constexpr ((EP & GEMM_EP_RESIDUAL) != 0) {
+        auto v_res = VECTOR_LOAD<T, LMUL>(ep.residual + row * ep.ld_residual + col, vl);
+        v = VECTOR_ADD<T, LMUL>(v, v_res, vl);
+    }
+    if constexpr ((EP & GEMM_EP_RELU) != 0) {
+        v = VECTOR_MAX<T, LMUL>(v, static_cast<T>(0), vl);
+    }
+    if constexpr ((EP & GEMM_EP_LEAKY_RELU) != 0) {
+        // max(x, 0) + alpha * min(x, 0): no mask, correct for any alpha
+        auto v_neg = VECTOR_MIN<T, LMUL>(v, static_cast<T>(0), vl);
+        v = VECTOR_MAX<T, LMUL>(v, static_cast<T>(0), vl);
+        v = VECTOR_FMACC_VF<T, LMUL>(v, ep.alpha, v_neg, vl);
+    }
+    if constexpr ((EP & GEMM_EP_CLIP) != 0) {
+        v = VECTOR_MAX<T, LMUL>(v, ep.clip_min, vl);
+        v = VECTOR_MIN<T, LMUL>(v, ep.clip_max, vl);
+    }
+    return v;
+}
+
+// Epilogue over an m x n block of C already in memory (used when K == 0)
+template<typename T, int LMUL, unsigned EP>
+inline void gemm_epilogue_block(size_t m, size_t n, T* C, ptrdiff_t ldc,
+                                const GemmEpilogue<T>& ep, size_t row0, size_t col0) {
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n;) {
+            size_t vl = SET_VECTOR_LENGTH<T, LMUL>(n - j);
+            auto v = VECTOR_LOAD<T, LMUL>(C + i * ldc + j, vl);
+            v = gemm_epilogue_apply<T, LMUL, EP>(v, ep, row0 + i, col0 + j, vl);
+            VECTOR_STORE<T, LMUL>(C + i * ldc + j, v, vl);
+            j += vl;
+        }
+    }
+}
+
+// Rows of C per microkernel tile: MR accumulators + 1 B group must fit in 32 registers
+template<int LMUL>
+constexpr size_t GEMM_MR = (LMUL == M8) ? 3 : (LMUL == M4) ? 6 : 8;
+
+// Pack mc x kc of A into MR-row panels, layout [panel][k][row]
+template<typename T, int LMUL, size_t MR = GEMM_MR<LMUL>>
+inline void gemm_pack_a(const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                        size_t mc, size_t kc, T* Ap) {
+    for (size_t i = 0; i < mc; i += MR) {
+        size_t mr = std::min(MR, mc - i);
+        T* panel = Ap + i * kc;
+
+        if (rs_a == 1 && cs_a != 1) {
+            // A^T (column-major A): the mr rows of one k are contiguous in memory and in the panel
+            for (size_t k = 0; k < kc; k++) {
+                for (size_t r = 0; r < mr;) {
+                    size_t vl = SET_VECTOR_LENGTH<T, LMUL>(mr - r);
+                    auto v_a = VECTOR_LOAD<T, LMUL>(A + k * cs_a + i + r, vl);
+                    VECTOR_STORE<T, LMUL>(panel + k * mr + r, v_a, vl);
+                    r += vl;
+                }
+            }
+            continue;
+        }
+
+        for (size_t r = 0; r < mr; r++) {
+            const T* a_row = A + (i + r) * rs_a;
+
+            for (size_t k = 0; k < kc;) {
+                size_t vl = SET_VECTOR_LENGTH<T, LMUL>(kc - k);
+                if (cs_a == 1) {
+                    auto v_a = VECTOR_LOAD<T, LMUL>(a_row + k, vl);
+                    VECTOR_STRIDED_STORE<T, LMUL>(panel + k * mr + r, mr * sizeof(T), v_a, vl);
+                } else {
+                    auto v_a = VECTOR_STRIDED_LOAD<T, LMUL>(a_row + k * cs_a, cs_a * sizeof(T), vl);
+                    VECTOR_STRIDED_STORE<T, LMUL>(panel + k * mr + r, mr * sizeof(T), v_a, vl);
+                }
+                k += vl;
+            }
+        }
+    }
+}
+
+// Pack kc x nc of B into NR-column panels, layout [panel][k][col]
+template<typename T, int LMUL>
+inline void gemm_pack_b(const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                        size_t kc, size_t nc, T* Bp) {
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+
+    for (size_t j = 0; j < nc; j += NR) {
+        size_t nr = std::min(NR, nc - j);
+        T* panel = Bp + j * kc;
+
+        if (rs_b == 1 && cs_b != 1) {
+            // B^T (e.g. [OUT x IN] weights): read each column along k, transpose into the panel
+            for (size_t c = 0; c < nr; c++) {
+                const T* b_col = B + (j + c) * cs_b;
+
+                for (size_t k = 0; k < kc;) {
+                    size_t vl = SET_VECTOR_LENGTH<T, LMUL>(kc - k);
+                    auto v_b = VECTOR_LOAD<T, LMUL>(b_col + k, vl);
+                    VECTOR_STRIDED_STORE<T, LMUL>(panel + k * nr + c, nr * sizeof(T), v_b, vl);
+                    k += vl;
+                }
+            }
+            continue;
+        }
+
+        for (size_t k = 0; k < kc; k++) {
+            const T* b_row = B + k * rs_b + j * cs_b;
+            if (cs_b == 1) {
+                auto v_b = VECTOR_LOAD<T, LMUL>(b_row, nr);
+                VECTOR_STORE<T, LMUL>(panel + k * nr, v_b, nr);
+            } else {
+                auto v_b = VECTOR_STRIDED_LOAD<T, LMUL>(b_row, cs_b * sizeof(T), nr);
+                VECTOR_STORE<T, LMUL>(panel + k * nr, v_b, nr);
+            }
+        }
+    }
+}
+
+// B packed once for reuse (e.g. constant weights): every KC x NC block in the order the
+// drivers consume them, each in the gemm_pack_b panel layout. Block (jc, pc) of width nc
+// starts at jc * K + pc * nc. Tied to the LMUL (panel width) and GEMM_KC / GEMM_NC it
+// was packed with, which the type carries for the first.
+template<typename T, int LMUL>
+struct GemmPackedB {
+    size_t K = 0, N = 0;
+    std::vector<T> data;
+
+    const T* block(size_t jc, size_t pc, size_t nc) const { return data.data() + jc * K + pc * nc; }
+};
+
+template<typename T, int LMUL>
+inline void gemm_prepack_b(size_t K, size_t N, const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                           GemmPackedB<T, LMUL>& pb) {
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+    const size_t nc_blk = std::min(N, std::max(NR, (size_t)GEMM_NC / NR * NR));
+    const size_t kc_blk = std::min(K, (size_t)GEMM_KC);
+
+    pb.K = K;
+    pb.N = N;
+    pb.data.assign(K * N, static_cast<T>(0));
+
+    for (size_t jc = 0; jc < N; jc += nc_blk) {
+        size_t nc = std::min(nc_blk, N - jc);
+        for (size_t pc = 0; pc < K; pc += kc_blk) {
+            size_t kc = std::min(kc_blk, K - pc);
+            gemm_pack_b<T, LMUL>(B + pc * rs_b + jc * cs_b, rs_b, cs_b, kc, nc,
+                                 pb.data.data() + jc * K + pc * nc);
+        }
+    }
+}
+
+// A packed once for reuse (e.g. conv filters times a changing activation B): every KC
+// block holds all M rows in the gemm_pack_a panel layout, so the MR-row panel starting at
+// row ic (a multiple of MR) of block pc is at pc * M + ic * kc, whatever MC the driver or
+// the thread split uses. Tied to the LMUL (panel height) and GEMM_KC it was packed with.
+template<typename T, int LMUL>
+struct GemmPackedA {
+    size_t M = 0, K = 0;
+    std::vector<T> data;
+
+    const T* block(size_t ic, size_t pc, size_t kc) const { return data.data() + pc * M + ic * kc; }
+};
+
+template<typename T, int LMUL>
+inline void gemm_prepack_a(size_t M, size_t K, const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                           GemmPackedA<T, LMUL>& pa) {
+    const size_t kc_blk = std::min(K, (size_t)GEMM_KC);
+
+    pa.M = M;
+    pa.K = K;
+    pa.data.assign(M * K, static_cast<T>(0));
+
+    for (size_t pc = 0; pc < K; pc += kc_blk) {
+        size_t kc = std::min(kc_blk, K - pc);
+        gemm_pack_a<T, LMUL>(A + pc * cs_a, rs_a, cs_a, M, kc, pa.data.data() + pc * M);
+    }
+}
+
+// ROWS x nr tile of C from one packed A panel and one packed B panel.
+// accumulate == false overwrites C, otherwise the tile is added to C.
+// A non-null ep runs the EP epilogue on the tile (whose top-left element is C[row][col]).
+template<typename T, int LMUL, size_t ROWS, unsigned EP = GEMM_EP_NONE>
+inline void gemm_microkernel(size_t kc, const T* Ap, const T* Bp, size_t nr,
+                             T* C, ptrdiff_t ldc, bool accumulate,
+                             const GemmEpilogue<T>* ep = nullptr, size_t row = 0, size_t col = 0) {
+    static_assert(ROWS >= 1 && ROWS <= 8, "microkernel supports 1..8 rows");
+
+    decltype(VECTOR_LOAD<T, LMUL>(Bp, nr)) c0, c1, c2, c3, c4, c5, c6, c7;
+
+    if (accumulate) {
+        if constexpr (ROWS > 0) c0 = VECTOR_LOAD<T, LMUL>(C + 0 * ldc, nr);
+        if constexpr (ROWS > 1) c1 = VECTOR_LOAD<T, LMUL>(C + 1 * ldc, nr);
+        if constexpr (ROWS > 2) c2 = VECTOR_LOAD<T, LMUL>(C + 2 * ldc, nr);
+        if constexpr (ROWS > 3) c3 = VECTOR_LOAD<T, LMUL>(C + 3 * ldc, nr);
+        if constexpr (ROWS > 4) c4 = VECTOR_LOAD<T, LMUL>(C + 4 * ldc, nr);
+        if constexpr (ROWS > 5) c5 = VECTOR_LOAD<T, LMUL>(C + 5 * ldc, nr);
+        if constexpr (ROWS > 6) c6 = VECTOR_LOAD<T, LMUL>(C + 6 * ldc, nr);
+        if constexpr (ROWS > 7) c7 = VECTOR_LOAD<T, LMUL>(C + 7 * ldc, nr);
+    } else {
+        auto v_zero = VECTOR_MOVE<T, LMUL>(static_cast<T>(0), nr);
+        if constexpr (ROWS > 0) c0 = v_zero;
+        if constexpr (ROWS > 1) c1 = v_zero;
+        if constexpr (ROWS > 2) c2 = v_zero;
+        if constexpr (ROWS > 3) c3 = v_zero;
+        if constexpr (ROWS > 4) c4 = v_zero;
+        if constexpr (ROWS > 5) c5 = v_zero;
+        if constexpr (ROWS > 6) c6 = v_zero;
+        if constexpr (ROWS > 7) c7 = v_zero;
+    }
+
+    for (size_t k = 0; k < kc; k++) {
+        // One B row segment is shared by all ROWS accumulators
+        auto v_b = VECTOR_LOAD<T, LMUL>(Bp + k * nr, nr);
+        const T* a = Ap + k * ROWS;
+
+        if constexpr (ROWS > 0) c0 = VECTOR_FMACC_VF<T, LMUL>(c0, a[0], v_b, nr);
+        if constexpr (ROWS > 1) c1 = VECTOR_FMACC_VF<T, LMUL>(c1, a[1], v_b, nr);
+        if constexpr (ROWS > 2) c2 = VECTOR_FMACC_VF<T, LMUL>(c2, a[2], v_b, nr);
+        if constexpr (ROWS > 3) c3 = VECTOR_FMACC_VF<T, LMUL>(c3, a[3], v_b, nr);
+        if constexpr (ROWS > 4) c4 = VECTOR_FMACC_VF<T, LMUL>(c4, a[4], v_b, nr);
+        if constexpr (ROWS > 5) c5 = VECTOR_FMACC_VF<T, LMUL>(c5, a[5], v_b, nr);
+        if constexpr (ROWS > 6) c6 = VECTOR_FMACC_VF<T, LMUL>(c6, a[6], v_b, nr);
+        if constexpr (ROWS > 7) c7 = VECTOR_FMACC_VF<T, LMUL>(c7, a[7], v_b, nr);
+    }
+
+    if constexpr (EP != GEMM_EP_NONE) {
+        if (ep) {
+            if constexpr (ROWS > 0) c0 = gemm_epilogue_apply<T, LMUL, EP>(c0, *ep, row + 0, col, nr);
+            if constexpr (ROWS > 1) c1 = gemm_epilogue_apply<T, LMUL, EP>(c1, *ep, row + 1, col, nr);
+            if constexpr (ROWS > 2) c2 = gemm_epilogue_apply<T, LMUL, EP>(c2, *ep, row + 2, col, nr);
+            if constexpr (ROWS > 3) c3 = gemm_epilogue_apply<T, LMUL, EP>(c3, *ep, row + 3, col, nr);
+            if constexpr (ROWS > 4) c4 = gemm_epilogue_apply<T, LMUL, EP>(c4, *ep, row + 4, col, nr);
+            if constexpr (ROWS > 5) c5 = gemm_epilogue_apply<T, LMUL, EP>(c5, *ep, row + 5, col, nr);
+            if constexpr (ROWS > 6) c6 = gemm_epilogue_apply<T, LMUL, EP>(c6, *ep, row + 6, col, nr);
+            if constexpr (ROWS > 7) c7 = gemm_epilogue_apply<T, LMUL, EP>(c7, *ep, row + 7, col, nr);
+        }
+    }
+
+    if constexpr (ROWS > 0) VECTOR_STORE<T, LMUL>(C + 0 * ldc, c0, nr);
+    if constexpr (ROWS > 1) VECTOR_STORE<T, LMUL>(C + 1 * ldc, c1, nr);
+    if constexpr (ROWS > 2) VECTOR_STORE<T, LMUL>(C + 2 * ldc, c2, nr);
+    if constexpr (ROWS > 3) VECTOR_STORE<T, LMUL>(C + 3 * ldc, c3, nr);
+    if constexpr (ROWS > 4) VECTOR_STORE<T, LMUL>(C + 4 * ldc, c4, nr);
+    if constexpr (ROWS > 5) VECTOR_STORE<T, LMUL>(C + 5 * ldc, c5, nr);
+    if constexpr (ROWS > 6) VECTOR_STORE<T, LMUL>(C + 6 * ldc, c6, nr);
+    if constexpr (ROWS > 7) VECTOR_STORE<T, LMUL>(C + 7 * ldc, c7, nr);
+}
+
+// Selects the microkernel instance for an mr-row tile (mr <= ROWS)
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE, size_t ROWS = GEMM_MR<LMUL>>
+inline void gemm_microkernel_rows(size_t mr, size_t kc, const T* Ap, const T* Bp, size_t nr,
+                                  T* C, ptrdiff_t ldc, bool accumulate,
+                                  const GemmEpilogue<T>* ep = nullptr, size_t row = 0, size_t col = 0) {
+    if (mr == ROWS) {
+        gemm_microkernel<T, LMUL, ROWS, EP>(kc, Ap, Bp, nr, C, ldc, accumulate, ep, row, col);
+    } else if constexpr (ROWS > 1) {
+        gemm_microkernel_rows<T, LMUL, EP, ROWS - 1>(mr, kc, Ap, Bp, nr, C, ldc, accumulate, ep, row, col);
+    }
+}
+
+// Sweeps the microkernel over an mc x nc block of C from packed A / B blocks.
+// row0 / col0 locate the block inside the full C for the epilogue.
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_macrokernel(size_t mc, size_t nc, size_t kc,
+                             const T* Ap, const T* Bp,
+                             T* C, ptrdiff_t ldc, bool accumulate,
+                             const GemmEpilogue<T>* ep = nullptr, size_t row0 = 0, size_t col0 = 0) {
+    constexpr size_t MR = GEMM_MR<LMUL>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+
+    for (size_t j = 0; j < nc; j += NR) {
+        size_t nr = std::min(NR, nc - j);
+        const T* b_panel = Bp + j * kc;
+
+        for (size_t i = 0; i < mc; i += MR) {
+            size_t mr = std::min(MR, mc - i);
+            const T* a_panel = Ap + i * kc;
+
+            gemm_microkernel_rows<T, LMUL, EP>(mr, kc, a_panel, b_panel, nr,
+                                               C + i * ldc + j, ldc, accumulate,
+                                               ep, row0 + i, col0 + j);
+        }
+    }
+}
+
+// Packing buffers, reusable across calls (e.g. over the items of a batch)
+template<typename T>
+struct GemmWorkspace {
+    std::vector<T> a_pack;
+    std::vector<T> b_pack;
+};
+
+// Single-threaded driver. rs_* / cs_* are row / column strides in elements.
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_packed_st(size_t M, size_t N, size_t K,
+                           const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                           const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                           T* C, ptrdiff_t ldc, bool accumulate,
+                           GemmWorkspace<T>& ws, const GemmEpilogue<T>* ep = nullptr,
+                           const GemmPackedB<T, LMUL>* pb = nullptr,
+                           const GemmPackedA<T, LMUL>* pa = nullptr) {
+    constexpr size_t MR = GEMM_MR<LMUL>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+
+    const size_t mc_blk = std::min(M, std::max(MR, (size_t)GEMM_MC / MR * MR));
+    const size_t nc_blk = std::min(N, std::max(NR, (size_t)GEMM_NC / NR * NR));
+    const size_t kc_blk = std::min(K, (size_t)GEMM_KC);
+
+    // Buffers only ever grow, so a batch of equal-sized problems allocates once
+    if (!pa && ws.a_pack.size() < mc_blk * kc_blk) ws.a_pack.resize(mc_blk * kc_blk);
+    if (!pb && ws.b_pack.size() < kc_blk * nc_blk) ws.b_pack.resize(kc_blk * nc_blk);
+    std::vector<T>& a_pack = ws.a_pack;
+    std::vector<T>& b_pack = ws.b_pack;
+
+    for (size_t jc = 0; jc < N; jc += nc_blk) {
+        size_t nc = std::min(nc_blk, N - jc);
+
+        for (size_t pc = 0; pc < K; pc += kc_blk) {
+            size_t kc = std::min(kc_blk, K - pc);
+            // First K block writes C, later ones accumulate into it; the last one runs the epilogue
+            bool acc = accumulate || pc > 0;
+            const GemmEpilogue<T>* ep_k = (pc + kc == K) ? ep : nullptr;
+
+            // A prepacked B is used in place; otherwise this block is packed now
+            const T* b_blk = pb ? pb->block(jc, pc, nc) : b_pack.data();
+            if (!pb) gemm_pack_b<T, LMUL>(B + pc * rs_b + jc * cs_b, rs_b, cs_b, kc, nc, b_pack.data());
+
+            for (size_t ic = 0; ic < M; ic += mc_blk) {
+                size_t mc = std::min(mc_blk, M - ic);
+
+                const T* a_blk = pa ? pa->block(ic, pc, kc) : a_pack.data();
+                if (!pa) gemm_pack_a<T, LMUL>(A + ic * rs_a + pc * cs_a, rs_a, cs_a, mc, kc, a_pack.data());
+                gemm_macrokernel<T, LMUL, EP>(mc, nc, kc, a_blk, b_blk,
+                                              C + ic * ldc + jc, ldc, acc, ep_k, ic, jc);
+            }
+        }
+    }
+}
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_packed_st(size_t M, size_t N, size_t K,
+                           const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                           const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                           T* C, ptrdiff_t ldc, bool accumulate,
+                           const GemmEpilogue<T>* ep = nullptr) {
+    GemmWorkspace<T> ws;
+    gemm_packed_st<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, ws, ep);
+}
+
+
+// Picks a tm x tn grid for nt workers that minimises the largest per-worker tile count,
+// preferring the squarer grid (less packing traffic) on ties.
+inline void gemm_thread_grid(int nt, size_t m_panels, size_t n_panels, int& tm, int& tn) {
+    size_t best_cost = (size_t)-1;
+    size_t best_perim = (size_t)-1;
+    tm = 1;
+    tn = 1;
+
+    for (int r = 1; r <= nt && (size_t)r <= m_panels; r++) {
+        int c = (int)std::min((size_t)(nt / r), n_panels);
+
+        size_t cost = ((m_panels + r - 1) / r) * ((n_panels + c - 1) / c);
+        size_t perim = (size_t)(r + c);
+        if (cost < best_cost || (cost == best_cost && perim < best_perim)) {
+            best_cost = cost;
+            best_perim = perim;
+            tm = r;
+            tn = c;
+        }
+    }
+}
+
+template<typename T>
+struct GemmThreadCtx {
+    size_t M, N, K;
+    const T* A; ptrdiff_t rs_a, cs_a;
+    const T* B; ptrdiff_t rs_b, cs_b;
+    T* C; ptrdiff_t ldc;
+    bool accumulate;
+    const GemmEpilogue<T>* ep;
+
+    size_t nc_blk, kc_blk;
+    int nt, tm, tn;
+    T* b_pack;                  // shared, read-only once a K block is packed
+    const T* b_prepacked;       // GemmPackedB data: no packing and no barriers
+    const T* a_prepacked;       // GemmPackedA data: no per-worker A packing
+    pthread_barrier_t barrier;
+
+    // Workers wait here until the grid is fixed (it depends on how many actually started)
+    pthread_mutex_t lock;
+    pthread_cond_t go;
+    bool started;
+};
+
+template<typename T>
+struct GemmThreadArg {
+    GemmThreadCtx<T>* ctx;
+    int tid;
+};
+
+template<typename T, int LMUL, unsigned EP>
+inline void gemm_mt_run(GemmThreadCtx<T>* ctx, int tid) {
+    constexpr size_t MR = GEMM_MR<LMUL>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+
+    const int ti = tid / ctx->tn;
+    const int tj = tid % ctx->tn;
+
+    // Row range of this worker, on MR boundaries
+    const size_t m_panels = (ctx->M + MR - 1) / MR;
+    const size_t i0 = std::min(ctx->M, m_panels * ti / ctx->tm * MR);
+    const size_t i1 = std::min(ctx->M, m_panels * (ti + 1) / ctx->tm * MR);
+
+    const size_t mc_blk = std::max(MR, (size_t)GEMM_MC / MR * MR);
+    std::vector<T> a_pack(ctx->a_prepacked ? 0 : mc_blk * ctx->kc_blk);
+
+    for (size_t jc = 0; jc < ctx->N; jc += ctx->nc_blk) {
+        size_t nc = std::min(ctx->nc_blk, ctx->N - jc);
+
+        // Column range of this worker inside the NC block, on NR boundaries
+        size_t n_panels = (nc + NR - 1) / NR;
+        size_t j0 = std::min(nc, n_panels * tj / ctx->tn * NR);
+        size_t j1 = std::min(nc, n_panels * (tj + 1) / ctx->tn * NR);
+
+        for (size_t pc = 0; pc < ctx->K; pc += ctx->kc_blk) {
+            size_t kc = std::min(ctx->kc_blk, ctx->K - pc);
+            bool acc = ctx->accumulate || pc > 0;
+            const GemmEpilogue<T>* ep_k = (pc + kc == ctx->K) ? ctx->ep : nullptr;
+
+            const T* b_blk = ctx->b_prepacked ? ctx->b_prepacked + jc * ctx->K + pc * nc : ctx->b_pack;
+
+            if (!ctx->b_prepacked) {
+                // Cooperative B packing: panel p is packed by worker p % nt
+                for (size_t p = tid; p < n_panels; p += ctx->nt) {
+                    size_t j = p * NR;
+                    gemm_pack_b<T, LMUL>(ctx->B + pc * ctx->rs_b + (jc + j) * ctx->cs_b,
+                                         ctx->rs_b, ctx->cs_b, kc, std::min(NR, nc - j),
+                                         ctx->b_pack + j * kc);
+                }
+                pthread_barrier_wait(&ctx->barrier);
+            }
+
+            if (j1 > j0) {
+                for (size_t ic = i0; ic < i1; ic += mc_blk) {
+                    size_t mc = std::min(mc_blk, i1 - ic);
+
+                    const T* a_blk = ctx->a_prepacked ? ctx->a_prepacked + pc * ctx->M + ic * kc : a_pack.data();
+                    if (!ctx->a_prepacked) {
+                        gemm_pack_a<T, LMUL>(ctx->A + ic * ctx->rs_a + pc * ctx->cs_a,
+                                             ctx->rs_a, ctx->cs_a, mc, kc, a_pack.data());
+                    }
+                    gemm_macrokernel<T, LMUL, EP>(mc, j1 - j0, kc, a_blk, b_blk + j0 * kc,
+                                                  ctx->C + ic * ctx->ldc + jc + j0, ctx->ldc, acc,
+                                                  ep_k, ic, jc + j0);
+                }
+            }
+            // Nobody repacks B until every worker is done reading it
+            if (!ctx->b_prepacked) pthread_barrier_wait(&ctx->barrier);
+        }
+    }
+}
+
+template<typename T, int LMUL, unsigned EP>
+inline void* gemm_mt_worker(void* p) {
+    auto* arg = static_cast<GemmThreadArg<T>*>(p);
+    GemmThreadCtx<T>* ctx = arg->ctx;
+
+    pthread_mutex_lock(&ctx->lock);
+    while (!ctx->started) pthread_cond_wait(&ctx->go, &ctx->lock);
+    pthread_mutex_unlock(&ctx->lock);
+
+    // Spare workers (grid smaller than the number started) have nothing to do
+    if (arg->tid < ctx->nt) gemm_mt_run<T, LMUL, EP>(ctx, arg->tid);
+    return nullptr;
+}
+
+// Multi-threaded driver: num_threads workers (the caller is worker 0) over a 2D grid of C
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_packed_mt(size_t M, size_t N, size_t K,
+                           const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                           const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                           T* C, ptrdiff_t ldc, bool accumulate, int num_threads,
+                           const GemmEpilogue<T>* ep = nullptr,
+                           const GemmPackedB<T, LMUL>* pb = nullptr,
+                           const GemmPackedA<T, LMUL>* pa = nullptr) {
+    constexpr size_t MR = GEMM_MR<LMUL>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+
+    GemmThreadCtx<T> ctx;
+    ctx.M = M; ctx.N = N; ctx.K = K;
+    ctx.A = A; ctx.rs_a = rs_a; ctx.cs_a = cs_a;
+    ctx.B = B; ctx.rs_b = rs_b; ctx.cs_b = cs_b;
+    ctx.C = C; ctx.ldc = ldc;
+    ctx.accumulate = accumulate;
+    ctx.ep = ep;
+    ctx.nc_blk = std::min(N, std::max(NR, (size_t)GEMM_NC / NR * NR));
+    ctx.kc_blk = std::min(K, (size_t)GEMM_KC);
+
+    // Never more workers than there are MR x NR tiles in one NC block
+    size_t m_panels = (M + MR - 1) / MR;
+    size_t n_panels = (ctx.nc_blk + NR - 1) / NR;
+    int want = (int)std::min((size_t)num_threads, m_panels * n_panels);
+
+    if (want <= 1) {
+        GemmWorkspace<T> ws;
+        gemm_packed_st<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, ws, ep, pb, pa);
+        return;
+    }
+
+    std::vector<T> b_pack(pb ? 0 : ctx.kc_blk * ctx.nc_blk);
+    ctx.b_pack = b_pack.data();
+    ctx.b_prepacked = pb ? pb->data.data() : nullptr;
+    ctx.a_prepacked = pa ? pa->data.data() : nullptr;
+    ctx.started = false;
+    pthread_mutex_init(&ctx.lock, nullptr);
+    pthread_cond_init(&ctx.go, nullptr);
+
+    std::vector<pthread_t> threads(want);
+    std::vector<GemmThreadArg<T>> args(want);
+    int created = 1;
+    for (int t = 1; t < want; t++) {
+        args[t] = {&ctx, t};
+        if (pthread_create(&threads[t], nullptr, gemm_mt_worker<T, LMUL, EP>, &args[t]) != 0) break;
+        created++;
+    }
+
+    // Size the grid for the workers we really have, then release them
+    gemm_thread_grid(created, m_panels, n_panels, ctx.tm, ctx.tn);
+    ctx.nt = ctx.tm * ctx.tn;
+    pthread_barrier_init(&ctx.barrier, nullptr, ctx.nt);
+
+    pthread_mutex_lock(&ctx.lock);
+    ctx.started = true;
+    pthread_cond_broadcast(&ctx.go);
+    pthread_mutex_unlock(&ctx.lock);
+
+    gemm_mt_run<T, LMUL, EP>(&ctx, 0);
+    for (int t = 1; t < created; t++) {
+        pthread_join(threads[t], nullptr);
+    }
+
+    pthread_barrier_destroy(&ctx.barrier);
+    pthread_cond_destroy(&ctx.go);
+    pthread_mutex_destroy(&ctx.lock);
+}
+
+/*
+Split-K: K is cut into S runs of whole KC blocks. Slice 0 multiplies into C itself (so
+accumulate keeps its meaning), slices 1 .. S-1 into private dense M x N buffers. After
+the join the partials are added into C row by row and the epilogue is applied on that
+single pass, so C is still written only once per element after the products finish.
+*/
+
+template<typename T>
+struct GemmSplitKCtx {
+    size_t M, N;
+    const T* A; ptrdiff_t rs_a, cs_a;
+    const T* B; ptrdiff_t rs_b, cs_b;
+    T* C; ptrdiff_t ldc;
+    bool accumulate;
+    size_t k0, k1;              // K range of this slice
+};
+
+template<typename T, int LMUL>
+inline void gemm_splitk_run(GemmSplitKCtx<T>* ctx) {
+    gemm_packed_st<T, LMUL>(ctx->M, ctx->N, ctx->k1 - ctx->k0,
+                            ctx->A + ctx->k0 * ctx->cs_a, ctx->rs_a, ctx->cs_a,
+                            ctx->B + ctx->k0 * ctx->rs_b, ctx->rs_b, ctx->cs_b,
+                            ctx->C, ctx->ldc, ctx->accumulate);
+}
+
+template<typename T, int LMUL>
+inline void* gemm_splitk_worker(void* p) {
+    gemm_splitk_run<T, LMUL>(static_cast<GemmSplitKCtx<T>*>(p));
+    return nullptr;
+}
+
+// C += sum of num_partials dense M x N buffers spaced M * N apart, then the epilogue
+template<typename T, int LMUL, unsigned EP>
+inline void gemm_splitk_reduce(size_t M, size_t N, T* C, ptrdiff_t ldc,
+                               const T* partials, size_t num_partials,
+                               const GemmEpilogue<T>* ep) {
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < N;) {
+            size_t vl = SET_VECTOR_LENGTH<T, LMUL>(N - j);
+            auto v_c = VECTOR_LOAD<T, LMUL>(C + i * ldc + j, vl);
+
+            for (size_t s = 0; s < num_partials; s++) {
+                auto v_p = VECTOR_LOAD<T, LMUL>(partials + s * M * N + i * N + j, vl);
+                v_c = VECTOR_ADD<T, LMUL>(v_c, v_p, vl);
+            }
+            if constexpr (EP != GEMM_EP_NONE) {
+                if (ep) v_c = gemm_epilogue_apply<T, LMUL, EP>(v_c, *ep, i, j, vl);
+            }
+
+            VECTOR_STORE<T, LMUL>(C + i * ldc + j, v_c, vl);
+            j += vl;
+        }
+    }
+}
+
+// Split-K driver over num_threads workers (the caller runs slice 0)
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_packed_splitk(size_t M, size_t N, size_t K,
+                               const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                               const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                               T* C, ptrdiff_t ldc, bool accumulate, int num_threads,
+                               const GemmEpilogue<T>* ep = nullptr) {
+    const size_t k_blocks = (K + GEMM_KC - 1) / GEMM_KC;
+    const int S = (int)std::min((size_t)std::max(num_threads, 1), k_blocks);
+
+    if (S <= 1) {
+        gemm_packed_st<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, ep);
+        return;
+    }
+
+    std::vector<T> partials((size_t)(S - 1) * M * N);
+    std::vector<GemmSplitKCtx<T>> ctx(S);
+    std::vector<pthread_t> threads(S);
+    std::vector<bool> running(S, false);
+
+    for (int s = 0; s < S; s++) {
+        size_t k0 = std::min(K, k_blocks * s / S * GEMM_KC);
+        size_t k1 = std::min(K, k_blocks * (s + 1) / S * GEMM_KC);
+        if (s == 0) {
+            ctx[s] = {M, N, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, k0, k1};
+        } else {
+            ctx[s] = {M, N, A, rs_a, cs_a, B, rs_b, cs_b,
+                      partials.data() + (size_t)(s - 1) * M * N, (ptrdiff_t)N, false, k0, k1};
+        }
+    }
+    for (int s = 1; s < S; s++) {
+        running[s] = pthread_create(&threads[s], nullptr, gemm_splitk_worker<T, LMUL>, &ctx[s]) == 0;
+    }
+
+    gemm_splitk_run<T, LMUL>(&ctx[0]);
+    for (int s = 1; s < S; s++) {
+        if (running[s]) {
+            pthread_join(threads[s], nullptr);
+        } else {
+            gemm_splitk_run<T, LMUL>(&ctx[s]);
+        }
+    }
+
+    gemm_splitk_reduce<T, LMUL, EP>(M, N, C, ldc, partials.data(), S - 1, ep);
+}
+
+// True when splitting K keeps more workers busy than splitting M x N
+template<typename T, int LMUL>
+inline bool gemm_use_splitk(size_t M, size_t N, size_t K, int num_threads) {
+    constexpr size_t MR = GEMM_MR<LMUL>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+
+    if (num_threads <= 1 || K < 2 * (size_t)GEMM_KC) return false;
+
+    size_t tiles = ((M + MR - 1) / MR) * ((std::min(N, (size_t)GEMM_NC) + NR - 1) / NR);
+    return K >= (size_t)GEMM_SPLITK_RATIO * M * N || tiles < (size_t)num_threads;
+}
+
+// General strided entry point. rs_* / cs_* are row / column strides in elements.
+// Runs on gemm_get_num_threads() workers once the problem is large enough, splitting K
+// instead of C when M x N is too small to occupy them.
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_packed_strided(size_t M, size_t N, size_t K,
+                                const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                                const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                                T* C, ptrdiff_t ldc, bool accumulate = false,
+                                const GemmEpilogue<T>* ep = nullptr) {
+    if (M == 0 || N == 0) return;
+
+    if (K == 0) {
+        if (!accumulate) {
+            for (size_t i = 0; i < M; i++) memset(C + i * ldc, 0, N * sizeof(T));
+        }
+        if constexpr (EP != GEMM_EP_NONE) {
+            if (ep) gemm_epilogue_block<T, LMUL, EP>(M, N, C, ldc, *ep, 0, 0);
+        }
+        return;
+    }
+
+    int num_threads = gemm_get_num_threads();
+    if (num_threads > 1 && M * N * K >= (size_t)GEMM_MT_MIN_WORK) {
+        if (gemm_use_splitk<T, LMUL>(M, N, K, num_threads)) {
+            gemm_packed_splitk<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, num_threads, ep);
+            return;
+        }
+        gemm_packed_mt<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, num_threads, ep);
+    } else {
+        gemm_packed_st<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, ep);
+    }
+}
+
+// C (+)= A * B with B prepacked by gemm_prepack_b: the B packing of every call is skipped.
+// Threaded like gemm_packed_strided, minus split-K (its slices would repack nothing but
+// still need the partial buffers, so the 2D grid is used for every shape).
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_prepacked(size_t M, const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                           const GemmPackedB<T, LMUL>& pb, T* C, ptrdiff_t ldc,
+                           bool accumulate = false, const GemmEpilogue<T>* ep = nullptr) {
+    const size_t N = pb.N, K = pb.K;
+    if (M == 0 || N == 0) return;
+
+    if (K == 0) {
+        gemm_packed_strided<T, LMUL, EP>(M, N, 0, A, rs_a, cs_a, pb.data.data(), 0, 0, C, ldc, accumulate, ep);
+        return;
+    }
+
+    int num_threads = gemm_get_num_threads();
+    if (num_threads > 1 && M * N * K >= (size_t)GEMM_MT_MIN_WORK) {
+        gemm_packed_mt<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, nullptr, 0, 0, C, ldc, accumulate, num_threads, ep, &pb);
+    } else {
+        GemmWorkspace<T> ws;
+        gemm_packed_st<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, nullptr, 0, 0, C, ldc, accumulate, ws, ep, &pb);
+    }
+}
+
+// C (+)= A * B with A prepacked by gemm_prepack_a: the A packing of every call (and of
+// every worker) is skipped. Threaded like gemm_prepacked.
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void gemm_prepacked_a(const GemmPackedA<T, LMUL>& pa, size_t N,
+                             const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b, T* C, ptrdiff_t ldc,
+                             bool accumulate = false, const GemmEpilogue<T>* ep = nullptr) {
+    const size_t M = pa.M, K = pa.K;
+    if (M == 0 || N == 0) return;
+
+    if (K == 0) {
+        gemm_packed_strided<T, LMUL, EP>(M, N, 0, pa.data.data(), 0, 0, B, rs_b, cs_b, C, ldc, accumulate, ep);
+        return;
+    }
+
+    int num_threads = gemm_get_num_threads();
+    if (num_threads > 1 && M * N * K >= (size_t)GEMM_MT_MIN_WORK) {
+        gemm_packed_mt<T, LMUL, EP>(M, N, K, nullptr, 0, 0, B, rs_b, cs_b, C, ldc, accumulate, num_threads,
+                                    ep, nullptr, &pa);
+    } else {
+        GemmWorkspace<T> ws;
+        gemm_packed_st<T, LMUL, EP>(M, N, K, nullptr, 0, 0, B, rs_b, cs_b, C, ldc, accumulate, ws, ep, nullptr, &pa);
+    }
+}
+
+/*
+Batched GEMM: C[b] (+)= A[b] * B[b] for b in [0, batch), all items sharing M, N, K and
+the row / column strides. Items are scheduled as a group rather than one call at a time:
+
+  - a broadcast B (stride_b == 0) over back-to-back A / C matrices is one tall GEMM with
+    batch * M rows, so small M no longer leaves the microkernel rows idle;
+  - otherwise small items share one packing workspace and, with several threads, whole
+    items are handed to workers instead of splitting each tiny product;
+  - items large enough to thread on their own go through gemm_packed_strided.
+*/
+
+template<typename T>
+struct GemmBatchCtx {
+    size_t M, N, K;
+    const T* const* A; ptrdiff_t rs_a, cs_a;
+    const T* const* B; ptrdiff_t rs_b, cs_b;
+    T* const* C; ptrdiff_t ldc;
+    bool accumulate;
+    size_t first, last;         // items [first, last) of one worker
+};
+
+template<typename T, int LMUL>
+inline void gemm_batch_run(GemmBatchCtx<T>* ctx) {
+    GemmWorkspace<T> ws;
+    for (size_t b = ctx->first; b < ctx->last; b++) {
+        gemm_packed_st<T, LMUL>(ctx->M, ctx->N, ctx->K,
+                                ctx->A[b], ctx->rs_a, ctx->cs_a,
+                                ctx->B[b], ctx->rs_b, ctx->cs_b,
+                                ctx->C[b], ctx->ldc, ctx->accumulate, ws);
+    }
+}
+
+template<typename T, int LMUL>
+inline void* gemm_batch_worker(void* p) {
+    gemm_batch_run<T, LMUL>(static_cast<GemmBatchCtx<T>*>(p));
+    return nullptr;
+}
+
+// Pointer-array form: item b uses A[b], B[b], C[b]
+template<typename T, int LMUL>
+inline void gemm_batched(size_t batch, size_t M, size_t N, size_t K,
+                         const T* const* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                         const T* const* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                         T* const* C, ptrdiff_t ldc, bool accumulate = false) {
+    if (batch == 0 || M == 0 || N == 0) return;
+
+    // Empty K (zero fill) and items big enough to be threaded on their own
+    if (K == 0 || M * N * K >= (size_t)GEMM_MT_MIN_WORK) {
+        for (size_t b = 0; b < batch; b++) {
+            gemm_packed_strided<T, LMUL>(M, N, K, A[b], rs_a, cs_a, B[b], rs_b, cs_b,
+                                         C[b], ldc, accumulate);
+        }
+        return;
+    }
+
+    // Contiguous runs of items per worker; the caller takes the first run
+    int nt = (int)std::min((size_t)gemm_get_num_threads(), batch);
+    std::vector<GemmBatchCtx<T>> ctx(nt);
+    std::vector<pthread_t> threads(nt);
+    std::vector<bool> running(nt, false);
+
+    for (int t = 0; t < nt; t++) {
+        ctx[t] = {M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate,
+                  batch * t / nt, batch * (t + 1) / nt};
+    }
+    for (int t = 1; t < nt; t++) {
+        running[t] = pthread_create(&threads[t], nullptr, gemm_batch_worker<T, LMUL>, &ctx[t]) == 0;
+    }
+
+    gemm_batch_run<T, LMUL>(&ctx[0]);
+    for (int t = 1; t < nt; t++) {
+        if (running[t]) {
+            pthread_join(threads[t], nullptr);
+        } else {
+            gemm_batch_run<T, LMUL>(&ctx[t]);
+        }
+    }
+}
+
+// Strided form: item b uses A + b * stride_a, B + b * stride_b, C + b * stride_c.
+// A zero stride_a / stride_b broadcasts that operand over the batch.
+template<typename T, int LMUL>
+inline void gemm_strided_batched(size_t batch, size_t M, size_t N, size_t K,
+                                 const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a, ptrdiff_t stride_a,
+                                 const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b, ptrdiff_t stride_b,
+                                 T* C, ptrdiff_t ldc, ptrdiff_t stride_c, bool accumulate = false) {
+    if (batch == 0 || M == 0 || N == 0) return;
+
+    // Shared B under stacked A / C rows: one GEMM with batch * M rows
+    if (stride_b == 0 && stride_a == (ptrdiff_t)M * rs_a && stride_c == (ptrdiff_t)M * ldc) {
+        gemm_packed_strided<T, LMUL>(batch * M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate);
+        return;
+    }
+
+    std::vector<const T*> a_ptrs(batch);
+    std::vector<const T*> b_ptrs(batch);
+    std::vector<T*> c_ptrs(batch);
+    for (size_t b = 0; b < batch; b++) {
+        a_ptrs[b] = A + (ptrdiff_t)b * stride_a;
+        b_ptrs[b] = B + (ptrdiff_t)b * stride_b;
+        c_ptrs[b] = C + (ptrdiff_t)b * stride_c;
+    }
+
+    gemm_batched<T, LMUL>(batch, M, N, K, a_ptrs.data(), rs_a, cs_a, b_ptrs.data(), rs_b, cs_b,
+                          c_ptrs.data(), ldc, accumulate);
+}
+
+// Row-major, densely stored A[M x K], B[K x N], C[M x N]
+template<typename T, int LMUL>
+inline void gemm_packed(const T* A, const T* B, T* C, size_t M, size_t N, size_t K,
+                        bool accumulate = false) {
+    gemm_packed_strided<T, LMUL>(M, N, K, A, K, 1, B, N, 1, C, N, accumulate);
+}
+
+// BLAS-style transposes: trans_a means A is stored [K x M], trans_b means B is stored
+// [N x K] (e.g. PyTorch Linear weights). Handled entirely by the packers.
+template<typename T, int LMUL>
+inline void gemm_packed_trans(bool trans_a, bool trans_b,
+                              const T* A, const T* B, T* C, size_t M, size_t N, size_t K,
+                              bool accumulate = false) {
+    ptrdiff_t rs_a = trans_a ? 1 : K, cs_a = trans_a ? M : 1;
+    ptrdiff_t rs_b = trans_b ? 1 : N, cs_b = trans_b ? K : 1;
+    gemm_packed_strided<T, LMUL>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, N, accumulate);
+}
+
+// Same, with the EP epilogue fused into the store of C
+template<typename T, int LMUL, unsigned EP>
+inline void gemm_packed_fused(const T* A, const T* B, T* C, size_t M, size_t N, size_t K,
+                              const GemmEpilogue<T>& ep, bool accumulate = false) {
+    gemm_packed_strided<T, LMUL, EP>(M, N, K, A, K, 1, B, N, 1, C, N, accumulate, &ep);
+}
+
+// Runtime pick among the compiled epilogues: ops is a GEMM_EP_* mask. Each combination
+// is its own instantiation, so the inner loop never branches on ops; if several
+// activations are set, the lowest flag wins.
+template<typename T, int LMUL, unsigned EP = GEMM_EP_NONE, unsigned BIT = GEMM_EP_BIAS>
+inline void gemm_packed_strided_ep(unsigned ops, size_t M, size_t N, size_t K,
+                                   const T* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                                   const T* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                                   T* C, ptrdiff_t ldc, const GemmEpilogue<T>& ep,
+                                   bool accumulate = false) {
+    constexpr unsigned ACT = GEMM_EP_RELU | GEMM_EP_LEAKY_RELU | GEMM_EP_CLIP;
+
+    if constexpr (BIT > GEMM_EP_CLIP) {
+        gemm_packed_strided<T, LMUL, EP>(M, N, K, A, rs_a, cs_a, B, rs_b, cs_b, C, ldc, accumulate, &ep);
+    } else if constexpr ((BIT & ACT) != 0 && (EP & ACT) != 0) {
+        gemm_packed_strided_ep<T, LMUL, EP, (BIT << 1)>(ops, M, N, K, A, rs_a, cs_a, B, rs_b, cs_b,
+                                                        C, ldc, ep, accumulate);
+    } else {
+        if (ops & BIT) {
+            gemm_packed_strided_ep<T, LMUL, (EP | BIT), (BIT << 1)>(ops, M, N, K, A, rs_a, cs_a, B, rs_b, cs_b,
+                                                                    C, ldc, ep, accumulate);
+        } else {
+            gemm_packed_strided_ep<T, LMUL, EP, (BIT << 1)>(ops, M, N, K, A, rs_a, cs_a, B, rs_b, cs_b,
+                                                            C, ldc, ep, accumulate);
+        }
+    }
+}
+
+#endif // RVV_GEMM_HPP
@@ -0,0 +1,256 @@
+#ifndef RVV_GEMM_INT8_HPP
+#define RVV_GEMM_INT8_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <riscv_vector.h>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+
+/*
+Quantized GEMM:  C[M x N] (int32) = (A[M x K] - za) * (B[K x N] - zb)   (int8 inputs)
+
+Same blocking as rvv_gemm.hpp, but the packed panels stay int8, so every packed byte is a
+quarter of the fp32 path. The microkernel sign-extends one B row to int16 (vsext, shared by
+all rows of the tile) and accumulates each row with a widening multiply-accumulate
+(vwmacc: int16 x int16 -> int32), which is exact for any K that fits the int32 range.
+
+LMUL names the int8 B group; the int32 accumulators use 4 * LMUL, so NR is VLMAX of int8 at
+LMUL and MR follows the register budget of the accumulators (M1 -> 6 rows, M2 -> 3 rows).
+
+Zero points are not applied inside the loop. The product expands to
+    sum (a - za)(b - zb) = sum a*b - zb * rowsum(A) - za * colsum(B) + K * za * zb
+so the raw int8 panels feed the microkernel and the row / column terms are added once per
+output element after the last K block.
+
+The optional requantize stage maps the int32 result to int8, per tensor or per output row
+(per channel, with the weights as A):
+    q = sat8(rnd((acc + bias[i]) * multiplier[i] >> (31 + shift[i])) + zero_point)
+using vwmul (int32 x int32 -> int64) and vnclip, which rounds and saturates while narrowing
+int64 -> int32 and then int32 -> int16 -> int8.
+*/
+
+// Fixed-point requantization parameters (one entry, or one per row of C when per_channel)
+struct GemmRequant {
+    const int32_t* multiplier = nullptr;  // Q31 multiplier
+    const int32_t* shift = nullptr;       // right shift applied after the Q31 product, >= -31
+    const int32_t* bias = nullptr;        // optional int32 bias per row of C
+    int32_t zero_point = 0;               // output zero point
+    bool per_channel = false;
+};
+
+// Splits a real scale (> 0) into a Q31 multiplier and a right shift: scale = m * 2^-31 * 2^-shift
+inline void gemm_quantize_multiplier(double scale, int32_t& multiplier, int32_t& shift) {
+    int exponent = 0;
+    double q = std::frexp(scale, &exponent);
+    int64_t m = static_cast<int64_t>(std::llround(q * (double)(1ll << 31)));
+    if (m == (1ll << 31)) {
+        m /= 2;
+        exponent++;
+    }
+    if (scale <= 0.0 || 31 - exponent > 63) {
+        // Too small to represent within a 63-bit rounding shift: rounds to zero anyway
+        m = 0;
+        exponent = 0;
+    }
+    multiplier = static_cast<int32_t>(m);
+    shift = -exponent;
+}
+
+// ROWS x nr tile of C (int32) from int8 packed panels
+template<int LMUL, size_t ROWS>
+inline void gemm_microkernel_s8(size_t kc, const int8_t* Ap, const int8_t* Bp, size_t nr,
+                                int32_t* C, ptrdiff_t ldc, bool accumulate) {
+    constexpr int HL = LMUL * 2;   // int16 B group
+    constexpr int WL = LMUL * 4;   // int32 accumulators
+    static_assert(ROWS >= 1 && ROWS <= 8, "microkernel supports 1..8 rows");
+
+    decltype(VECTOR_LOAD<int32_t, WL>(C, nr)) c0, c1, c2, c3, c4, c5, c6, c7;
+
+    if (accumulate) {
+        if constexpr (ROWS > 0) c0 = VECTOR_LOAD<int32_t, WL>(C + 0 * ldc, nr);
+        if constexpr (ROWS > 1) c1 = VECTOR_LOAD<int32_t, WL>(C + 1 * ldc, nr);
+        if constexpr (ROWS > 2) c2 = VECTOR_LOAD<int32_t, WL>(C + 2 * ldc, nr);
+        if constexpr (ROWS > 3) c3 = VECTOR_LOAD<int32_t, WL>(C + 3 * ldc, nr);
+        if constexpr (ROWS > 4) c4 = VECTOR_LOAD<int32_t, WL>(C + 4 * ldc, nr);
+        if constexpr (ROWS > 5) c5 = VECTOR_LOAD<int32_t, WL>(C + 5 * ldc, nr);
+        if constexpr (ROWS > 6) c6 = VECTOR_LOAD<int32_t, WL>(C + 6 * ldc, nr);
+        if constexpr (ROWS > 7) c7 = VECTOR_LOAD<int32_t, WL>(C + 7 * ldc, nr);
+    } else {
+        auto v_zero = VECTOR_MOVE<int32_t, WL>(static_cast<int32_t>(0), nr);
+        if constexpr (ROWS > 0) c0 = v_zero;
+        if constexpr (ROWS > 1) c1 = v_zero;
+        if constexpr (ROWS > 2) c2 = v_zero;
+        if constexpr (ROWS > 3) c3 = v_zero;
+        if constexpr (ROWS > 4) c4 = v_zero;
+        if constexpr (ROWS > 5) c5 = v_zero;
+        if constexpr (ROWS > 6) c6 = v_zero;
+        if constexpr (ROWS > 7) c7 = v_zero;
+    }
+
+    for (size_t k = 0; k < kc; k++) {
+        auto v_b = VECTOR_SEXT_VF2<int8_t, LMUL>(VECTOR_LOAD<int8_t, LMUL>(Bp + k * nr, nr), nr);
+        const int8_t* a = Ap + k * ROWS;
+
+        if constexpr (ROWS > 0) c0 = VECTOR_WMACC_VX<int16_t, HL>(c0, static_cast<int16_t>(a[0]), v_b, nr);
+        if constexpr (ROWS > 1) c1 = VECTOR_WMACC_VX<int16_t, HL>(c1, static_cast<int16_t>(a[1]), v_b, nr);
+        if constexpr (ROWS > 2) c2 = VECTOR_WMACC_VX<int16_t, HL>(c2, static_cast<int16_t>(a[2]), v_b, nr);
+        if constexpr (ROWS > 3) c3 = VECTOR_WMACC_VX<int16_t, HL>(c3, static_cast<int16_t>(a[3]), v_b, nr);
+        if constexpr (ROWS > 4) c4 = VECTOR_WMACC_VX<int16_t, HL>(c4, static_cast<int16_t>(a[4]), v_b, nr);
+        if constexpr (ROWS > 5) c5 = VECTOR_WMACC_VX<int16_t, HL>(c5, static_cast<int16_t>(a[5]), v_b, nr);
+        if constexpr (ROWS > 6) c6 = VECTOR_WMACC_VX<int16_t, HL>(c6, static_cast<int16_t>(a[6]), v_b, nr);
+        if constexpr (ROWS > 7) c7 = VECTOR_WMACC_VX<int16_t, HL>(c7, static_cast<int16_t>(a[7]), v_b, nr);
+    }
+
+    if constexpr (ROWS > 0) VECTOR_STORE<int32_t, WL>(C + 0 * ldc, c0, nr);
+    if constexpr (ROWS > 1) VECTOR_STORE<int32_t, WL>(C + 1 * ldc, c1, nr);
+    if constexpr (ROWS > 2) VECTOR_STORE<int32_t, WL>(C + 2 * ldc, c2, nr);
+    if constexpr (ROWS > 3) VECTOR_STORE<int32_t, WL>(C + 3 * ldc, c3, nr);
+    if constexpr (ROWS > 4) VECTOR_STORE<int32_t, WL>(C + 4 * ldc, c4, nr);
+    if constexpr (ROWS > 5) VECTOR_STORE<int32_t, WL>(C + 5 * ldc, c5, nr);
+    if constexpr (ROWS > 6) VECTOR_STORE<int32_t, WL>(C + 6 * ldc, c6, nr);
+    if constexpr (ROWS > 7) VECTOR_STORE<int32_t, WL>(C + 7 * ldc, c7, nr);
+}
+
+template<int LMUL, size_t ROWS = GEMM_MR<LMUL * 4>>
+inline void gemm_microkernel_s8_rows(size_t mr, size_t kc, const int8_t* Ap, const int8_t* Bp, size_t nr,
+                                     int32_t* C, ptrdiff_t ldc, bool accumulate) {
+    if (mr == ROWS) {
+        gemm_microkernel_s8<LMUL, ROWS>(kc, Ap, Bp, nr, C, ldc, accumulate);
+    } else if constexpr (ROWS > 1) {
+        gemm_microkernel_s8_rows<LMUL, ROWS - 1>(mr, kc, Ap, Bp, nr, C, ldc, accumulate);
+    }
+}
+
+// Adds the zero-point terms (and bias) to an m x n block of int32 results, then either
+// stores it back to C or requantizes it into Y. Rows are absolute rows of C.
+inline void gemm_s8_finish(size_t m, size_t n, int32_t* C, ptrdiff_t ldc,
+                           const int32_t* row_term, const int32_t* col_term,
+                           const GemmRequant* rq, int8_t* Y, ptrdiff_t ldy) {
+    for (size_t i = 0; i < m; i++) {
+        int32_t r = row_term ? row_term[i] : 0;
+        int32_t mult = 0;
+        size_t sh = 0;
+        if (rq) {
+            size_t ch = rq->per_channel ? i : 0;
+            r += rq->bias ? rq->bias[i] : 0;
+            mult = rq->multiplier[ch];
+            sh = static_cast<size_t>(31 + rq->shift[ch]);
+        }
+
+        for (size_t j = 0; j < n;) {
+            size_t vl = SET_VECTOR_LENGTH<int32_t, M4>(n - j);
+            auto v_c = VECTOR_LOAD<int32_t, M4>(C + i * ldc + j, vl);
+            if (col_term) v_c = VECTOR_ADD<int32_t, M4>(v_c, VECTOR_LOAD<int32_t, M4>(col_term + j, vl), vl);
+            if (r != 0) v_c = VECTOR_ADD<int32_t, M4>(v_c, r, vl);
+
+            if (!rq) {
+                VECTOR_STORE<int32_t, M4>(C + i * ldc + j, v_c, vl);
+            } else {
+                auto v_w = VECTOR_WMUL_VX<int32_t, M4>(v_c, mult, vl);
+                auto v_q = VECTOR_NCLIP<int32_t, M4>(v_w, sh, vl);
+                v_q = VECTOR_ADD<int32_t, M4>(v_q, rq->zero_point, vl);
+                auto v_h = VECTOR_NCLIP<int16_t, M2>(v_q, 0, vl);
+                VECTOR_STORE<int8_t, M1>(Y + i * ldy + j, VECTOR_NCLIP<int8_t, M1>(v_h, 0, vl), vl);
+            }
+            j += vl;
+        }
+    }
+}
+
+// Single-threaded driver. rs_* / cs_* are row / column strides in elements.
+// With rq == nullptr the int32 result goes to C; otherwise C is ignored and the
+// requantized int8 result goes to Y.
+template<int LMUL>
+inline void gemm_packed_s8_driver(size_t M, size_t N, size_t K,
+                                  const int8_t* A, ptrdiff_t rs_a, ptrdiff_t cs_a, int32_t za,
+                                  const int8_t* B, ptrdiff_t rs_b, ptrdiff_t cs_b, int32_t zb,
+                                  int32_t* C, ptrdiff_t ldc,
+                                  const GemmRequant* rq, int8_t* Y, ptrdiff_t ldy) {
+    static_assert(LMUL == M1 || LMUL == M2, "int32 accumulators need 4 * LMUL <= 8");
+    constexpr size_t MR = GEMM_MR<LMUL * 4>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<int8_t, LMUL>();
+
+    if (M == 0 || N == 0) return;
+
+    const size_t mc_blk = std::min(M, std::max(MR, (size_t)GEMM_MC / MR * MR));
+    const size_t nc_blk = std::min(N, std::max(NR, (size_t)GEMM_NC / NR * NR));
+    const size_t kc_blk = std::max((size_t)1, std::min(K, (size_t)GEMM_KC));
+
+    // Zero-point terms: -zb * rowsum(A) per row, K * za * zb - za * colsum(B) per column
+    std::vector<int32_t> row_term(zb != 0 ? M : 0);
+    std::vector<int32_t> col_term(za != 0 ? N : 0);
+    for (size_t i = 0; i < row_term.size(); i++) {
+        int32_t s = 0;
+        for (size_t k = 0; k < K; k++) s += A[i * rs_a + k * cs_a];
+        row_term[i] = -zb * s;
+    }
+    for (size_t j = 0; j < col_term.size(); j++) {
+        int32_t s = 0;
+        for (size_t k = 0; k < K; k++) s += B[k * rs_b + j * cs_b];
+        col_term[j] = static_cast<int32_t>(K) * za * zb - za * s;
+    }
+
+    std::vector<int8_t> a_pack(mc_blk * kc_blk);
+    std::vector<int8_t> b_pack(kc_blk * nc_blk);
+    std::vector<int32_t> c_blk(rq ? M * nc_blk : 0);
+
+    for (size_t jc = 0; jc < N; jc += nc_blk) {
+        size_t nc = std::min(nc_blk, N - jc);
+        int32_t* Cb = rq ? c_blk.data() : C + jc;
+        ptrdiff_t ldcb = rq ? (ptrdiff_t)nc_blk : ldc;
+
+        if (K == 0) {
+            for (size_t i = 0; i < M; i++) std::fill(Cb + i * ldcb, Cb + i * ldcb + nc, 0);
+        }
+
+        for (size_t pc = 0; pc < K; pc += kc_blk) {
+            size_t kc = std::min(kc_blk, K - pc);
+
+            gemm_pack_b<int8_t, LMUL>(B + pc * rs_b + jc * cs_b, rs_b, cs_b, kc, nc, b_pack.data());
+
+            for (size_t ic = 0; ic < M; ic += mc_blk) {
+                size_t mc = std::min(mc_blk, M - ic);
+
+                gemm_pack_a<int8_t, LMUL, MR>(A + ic * rs_a + pc * cs_a, rs_a, cs_a, mc, kc, a_pack.data());
+
+                for (size_t j = 0; j < nc; j += NR) {
+                    size_t nr = std::min(NR, nc - j);
+                    for (size_t i = 0; i < mc; i += MR) {
+                        gemm_microkernel_s8_rows<LMUL>(std::min(MR, mc - i), kc,
+                                                       a_pack.data() + i * kc, b_pack.data() + j * kc, nr,
+                                                       Cb + (ic + i) * ldcb + j, ldcb, pc > 0);
+                    }
+                }
+            }
+        }
+
+        gemm_s8_finish(M, nc, Cb, ldcb,
+                       row_term.empty() ? nullptr : row_term.data(),
+                       col_term.empty() ? nullptr : col_term.data() + jc,
+                       rq, rq ? Y + jc : nullptr, ldy);
+    }
+}
+
+// int32 result: C = (A - za) * (B - zb)
+template<int LMUL>
+inline void gemm_packed_s8(size_t M, size_t N, size_t K,
+                           const int8_t* A, ptrdiff_t rs_a, ptrdiff_t cs_a, int32_t za,
+                           const int8_t* B, ptrdiff_t rs_b, ptrdiff_t cs_b, int32_t zb,
+                           int32_t* C, ptrdiff_t ldc) {
+    gemm_packed_s8_driver<LMUL>(M, N, K, A, rs_a, cs_a, za, B, rs_b, cs_b, zb, C, ldc, nullptr, nullptr, 0);
+}
+
+// Requantized int8 result: Y = requant((A - za) * (B - zb))
+template<int LMUL>
+inline void gemm_packed_s8_requant(size_t M, size_t N, size_t K,
+                                   const int8_t* A, ptrdiff_t rs_a, ptrdiff_t cs_a, int32_t za,
+                                   const int8_t* B, ptrdiff_t rs_b, ptrdiff_t cs_b, int32_t zb,
+                                   const GemmRequant& rq, int8_t* Y, ptrdiff_t ldy) {
+    gemm_packed_s8_driver<LMUL>(M, N, K, A, rs_a, cs_a, za, B, rs_b, cs_b, zb, nullptr, 0, &rq, Y, ldy);
+}
+
+#endif // RVV_GEMM_INT8_HPP
@@ -0,0 +1,152 @@
+#ifndef RVV_GEMM_MIXED_HPP
+#define RVV_GEMM_MIXED_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+
+/*
+Mixed-precision GEMM:  C[M x N] (TO) (+)= A[M x K] (TI) * B[K x N] (TI)
+
+Same blocking and packed layout as the engine in rvv_gemm.hpp, but the panels keep the
+narrow input type and the microkernel accumulates with a widening multiply-accumulate
+(vfwmacc: _Float16 x _Float16 -> float). Every packed byte moved or loaded is half the
+size of the fp32 path, while the sums keep fp32 precision.
+
+LMUL names the narrow B group; the accumulators use twice that (GEMM_WIDE_LMUL), so NR
+is VLMAX of the narrow type at LMUL (equal to VLMAX of TO at 2 * LMUL) and MR follows
+the register budget of the wide accumulators. LMUL is therefore at most M4.
+*/
+
+// LMUL of a widened result
+template<int LMUL>
+constexpr int GEMM_WIDE_LMUL = (LMUL == MF4) ? MF2 : (LMUL == MF2) ? M1 : LMUL * 2;
+
+// ROWS x nr tile of C (TO) from narrow packed panels
+template<typename TI, typename TO, int LMUL, size_t ROWS>
+inline void gemm_microkernel_widen(size_t kc, const TI* Ap, const TI* Bp, size_t nr,
+                                   TO* C, ptrdiff_t ldc, bool accumulate) {
+    constexpr int WL = GEMM_WIDE_LMUL<LMUL>;
+    static_assert(ROWS >= 1 && ROWS <= 8, "microkernel supports 1..8 rows");
+
+    decltype(VECTOR_LOAD<TO, WL>(C, nr)) c0, c1, c2, c3, c4, c5, c6, c7;
+
+    if (accumulate) {
+        if constexpr (ROWS > 0) c0 = VECTOR_LOAD<TO, WL>(C + 0 * ldc, nr);
+        if constexpr (ROWS > 1) c1 = VECTOR_LOAD<TO, WL>(C + 1 * ldc, nr);
+        if constexpr (ROWS > 2) c2 = VECTOR_LOAD<TO, WL>(C + 2 * ldc, nr);
+        if constexpr (ROWS > 3) c3 = VECTOR_LOAD<TO, WL>(C + 3 * ldc, nr);
+        if constexpr (ROWS > 4) c4 = VECTOR_LOAD<TO, WL>(C + 4 * ldc, nr);
+        if constexpr (ROWS > 5) c5 = VECTOR_LOAD<TO, WL>(C + 5 * ldc, nr);
+        if constexpr (ROWS > 6) c6 = VECTOR_LOAD<TO, WL>(C + 6 * ldc, nr);
+        if constexpr (ROWS > 7) c7 = VECTOR_LOAD<TO, WL>(C + 7 * ldc, nr);
+    } else {
+        auto v_zero = VECTOR_MOVE<TO, WL>(static_cast<TO>(0), nr);
+        if constexpr (ROWS > 0) c0 = v_zero;
+        if constexpr (ROWS > 1) c1 = v_zero;
+        if constexpr (ROWS > 2) c2 = v_zero;
+        if constexpr (ROWS > 3) c3 = v_zero;
+        if constexpr (ROWS > 4) c4 = v_zero;
+        if constexpr (ROWS > 5) c5 = v_zero;
+        if constexpr (ROWS > 6) c6 = v_zero;
+        if constexpr (ROWS > 7) c7 = v_zero;
+    }
+
+    for (size_t k = 0; k < kc; k++) {
+        auto v_b = VECTOR_LOAD<TI, LMUL>(Bp + k * nr, nr);
+        const TI* a = Ap + k * ROWS;
+
+        if constexpr (ROWS > 0) c0 = VECTOR_FWMACC_VF<TI, LMUL>(c0, a[0], v_b, nr);
+        if constexpr (ROWS > 1) c1 = VECTOR_FWMACC_VF<TI, LMUL>(c1, a[1], v_b, nr);
+        if constexpr (ROWS > 2) c2 = VECTOR_FWMACC_VF<TI, LMUL>(c2, a[2], v_b, nr);
+        if constexpr (ROWS > 3) c3 = VECTOR_FWMACC_VF<TI, LMUL>(c3, a[3], v_b, nr);
+        if constexpr (ROWS > 4) c4 = VECTOR_FWMACC_VF<TI, LMUL>(c4, a[4], v_b, nr);
+        if constexpr (ROWS > 5) c5 = VECTOR_FWMACC_VF<TI, LMUL>(c5, a[5], v_b, nr);
+        if constexpr (ROWS > 6) c6 = VECTOR_FWMACC_VF<TI, LMUL>(c6, a[6], v_b, nr);
+        if constexpr (ROWS > 7) c7 = VECTOR_FWMACC_VF<TI, LMUL>(c7, a[7], v_b, nr);
+    }
+
+    if constexpr (ROWS > 0) VECTOR_STORE<TO, WL>(C + 0 * ldc, c0, nr);
+    if constexpr (ROWS > 1) VECTOR_STORE<TO, WL>(C + 1 * ldc, c1, nr);
+    if constexpr (ROWS > 2) VECTOR_STORE<TO, WL>(C + 2 * ldc, c2, nr);
+    if constexpr (ROWS > 3) VECTOR_STORE<TO, WL>(C + 3 * ldc, c3, nr);
+    if constexpr (ROWS > 4) VECTOR_STORE<TO, WL>(C + 4 * ldc, c4, nr);
+    if constexpr (ROWS > 5) VECTOR_STORE<TO, WL>(C + 5 * ldc, c5, nr);
+    if constexpr (ROWS > 6) VECTOR_STORE<TO, WL>(C + 6 * ldc, c6, nr);
+    if constexpr (ROWS > 7) VECTOR_STORE<TO, WL>(C + 7 * ldc, c7, nr);
+}
+
+template<typename TI, typename TO, int LMUL, size_t ROWS = GEMM_MR<GEMM_WIDE_LMUL<LMUL>>>
+inline void gemm_microkernel_widen_rows(size_t mr, size_t kc, const TI* Ap, const TI* Bp, size_t nr,
+                                        TO* C, ptrdiff_t ldc, bool accumulate) {
+    if (mr == ROWS) {
+        gemm_microkernel_widen<TI, TO, LMUL, ROWS>(kc, Ap, Bp, nr, C, ldc, accumulate);
+    } else if constexpr (ROWS > 1) {
+        gemm_microkernel_widen_rows<TI, TO, LMUL, ROWS - 1>(mr, kc, Ap, Bp, nr, C, ldc, accumulate);
+    }
+}
+
+// Single-threaded driver. rs_* / cs_* are row / column strides in elements.
+template<typename TI, typename TO, int LMUL>
+inline void gemm_packed_widen(size_t M, size_t N, size_t K,
+                              const TI* A, ptrdiff_t rs_a, ptrdiff_t cs_a,
+                              const TI* B, ptrdiff_t rs_b, ptrdiff_t cs_b,
+                              TO* C, ptrdiff_t ldc, bool accumulate = false) {
+    static_assert(LMUL <= M4, "the widened accumulators need 2 * LMUL <= 8");
+    constexpr size_t MR = GEMM_MR<GEMM_WIDE_LMUL<LMUL>>;
+    const size_t NR = SET_VECTOR_LENGTH_MAX<TI, LMUL>();
+
+    if (M == 0 || N == 0) return;
+    if (K == 0) {
+        if (!accumulate) {
+            for (size_t i = 0; i < M; i++) std::fill(C + i * ldc, C + i * ldc + N, static_cast<TO>(0));
+        }
+        return;
+    }
+
+    const size_t mc_blk = std::min(M, std::max(MR, (size_t)GEMM_MC / MR * MR));
+    const size_t nc_blk = std::min(N, std::max(NR, (size_t)GEMM_NC / NR * NR));
+    const size_t kc_blk = std::min(K, (size_t)GEMM_KC);
+
+    std::vector<TI> a_pack(mc_blk * kc_blk);
+    std::vector<TI> b_pack(kc_blk * nc_blk);
+
+    for (size_t jc = 0; jc < N; jc += nc_blk) {
+        size_t nc = std::min(nc_blk, N - jc);
+
+        for (size_t pc = 0; pc < K; pc += kc_blk) {
+            size_t kc = std::min(kc_blk, K - pc);
+            bool acc = accumulate || pc > 0;
+
+            gemm_pack_b<TI, LMUL>(B + pc * rs_b + jc * cs_b, rs_b, cs_b, kc, nc, b_pack.data());
+
+            for (size_t ic = 0; ic < M; ic += mc_blk) {
+                size_t mc = std::min(mc_blk, M - ic);
+
+                gemm_pack_a<TI, LMUL, MR>(A + ic * rs_a + pc * cs_a, rs_a, cs_a, mc, kc, a_pack.data());
+
+                for (size_t j = 0; j < nc; j += NR) {
+                    size_t nr = std::min(NR, nc - j);
+                    for (size_t i = 0; i < mc; i += MR) {
+                        gemm_microkernel_widen_rows<TI, TO, LMUL>(std::min(MR, mc - i), kc,
+                                                                  a_pack.data() + i * kc, b_pack.data() + j * kc, nr,
+                                                                  C + (ic + i) * ldc + jc + j, ldc, acc);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Row-major, densely stored A[M x K], B[K x N] (TI) and C[M x N] (TO)
+template<typename TI, typename TO, int LMUL>
+inline void gemm_packed_widen(const TI* A, const TI* B, TO* C, size_t M, size_t N, size_t K,
+                              bool accumulate = false) {
+    gemm_packed_widen<TI, TO, LMUL>(M, N, K, A, K, 1, B, N, 1, C, N, accumulate);
+}
+
+#endif // RVV_GEMM_MIXED_HPP
@@ -0,0 +1,168 @@
+#ifndef RVV_GEMV_HPP
+#define RVV_GEMV_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+
+/*
+Matrix-vector product (GEMV) for batch-1 dense layers:
+
+    gemv_n:  y[N] (+)= W[N x K] * x[K]      weights stored [OUT x IN]
+    gemv_t:  y[N] (+)= x[K] * W[K x N]      weights stored [IN x OUT]
+
+With a single input row there is no reuse of B for the GEMM engine to exploit, so packing
+is pure overhead and the cost is one pass over the weights. Both kernels stream W along
+its contiguous dimension with unit-stride loads and keep several weight rows in flight,
+each with its own accumulator, so the loads of one row overlap the FMAs of the others.
+
+gemv_n runs vector dot products: every row of the block accumulates lane-wise partial
+sums over K and is reduced with a single vfredusum at the end (plus one for a K tail
+shorter than VLMAX), not once per element. gemv_t needs no reduction at all: every
+weight row is scaled by x[k] and accumulated into a VLMAX-wide slice of y.
+
+ldw is the row stride of W in elements. GEMV_ROWS rows are in flight: the accumulators,
+one group of x and one group of W fit in the 32 vector registers.
+*/
+
+template<int LMUL>
+constexpr size_t GEMV_ROWS = (LMUL == M8) ? 2 : (LMUL == M4) ? 6 : 8;
+
+// Sum of one row: the full-width accumulator plus the dot product of the K tail
+template<typename T, int LMUL, typename VecType>
+inline T gemv_row_sum(VecType acc, size_t vl_acc, const T* w_tail, VecType v_xt, size_t vl_tail, T init) {
+    auto v_sum = VECTOR_MOVE<T, M1>(init, 1);
+
+    if (vl_acc > 0) v_sum = VECTOR_VFREDSUM<T, LMUL>(acc, v_sum, vl_acc);
+    if (vl_tail > 0) {
+        auto v_p = VECTOR_MUL<T, LMUL>(VECTOR_LOAD<T, LMUL>(w_tail, vl_tail), v_xt, vl_tail);
+        v_sum = VECTOR_VFREDSUM<T, LMUL>(v_p, v_sum, vl_tail);
+    }
+    return VECTOR_EXTRACT_SCALAR<T, M1>(v_sum);
+}
+
+// ROWS consecutive rows of W (stride ldw) dotted with x
+template<typename T, int LMUL, size_t ROWS>
+inline void gemv_n_block(size_t K, const T* W, ptrdiff_t ldw, const T* x, T* y, bool accumulate) {
+    static_assert(ROWS >= 1 && ROWS <= 8, "gemv supports 1..8 rows in flight");
+    const size_t VL = SET_VECTOR_LENGTH_MAX<T, LMUL>();
+    const size_t k_full = K / VL * VL;
+    const size_t vl_tail = K - k_full;
+
+    auto v_zero = VECTOR_MOVE<T, LMUL>(static_cast<T>(0), VL);
+    decltype(v_zero) c0, c1, c2, c3, c4, c5, c6, c7;
+
+    if constexpr (ROWS > 0) c0 = v_zero;
+    if constexpr (ROWS > 1) c1 = v_zero;
+    if constexpr (ROWS > 2) c2 = v_zero;
+    if constexpr (ROWS > 3) c3 = v_zero;
+    if constexpr (ROWS > 4) c4 = v_zero;
+    if constexpr (ROWS > 5) c5 = v_zero;
+    if constexpr (ROWS > 6) c6 = v_zero;
+    if constexpr (ROWS > 7) c7 = v_zero;
+
+    // Full VLMAX chunks only, so every accumulator lane stays live until the reduction
+    for (size_t k = 0; k < k_full; k += VL) {
+        auto v_x = VECTOR_LOAD<T, LMUL>(x + k, VL);
+        const T* w = W + k;
+
+        if constexpr (ROWS > 0) c0 = VECTOR_FMACC_VV<T, LMUL>(c0, VECTOR_LOAD<T, LMUL>(w + 0 * ldw, VL), v_x, VL);
+        if constexpr (ROWS > 1) c1 = VECTOR_FMACC_VV<T, LMUL>(c1, VECTOR_LOAD<T, LMUL>(w + 1 * ldw, VL), v_x, VL);
+        if constexpr (ROWS > 2) c2 = VECTOR_FMACC_VV<T, LMUL>(c2, VECTOR_LOAD<T, LMUL>(w + 2 * ldw, VL), v_x, VL);
+        if constexpr (ROWS > 3) c3 = VECTOR_FMACC_VV<T, LMUL>(c3, VECTOR_LOAD<T, LMUL>(w + 3 * ldw, VL), v_x, VL);
+        if constexpr (ROWS > 4) c4 = VECTOR_FMACC_VV<T, LMUL>(c4, VECTOR_LOAD<T, LMUL>(w + 4 * ldw, VL), v_x, VL);
+        if constexpr (ROWS > 5) c5 = VECTOR_FMACC_VV<T, LMUL>(c5, VECTOR_LOAD<T, LMUL>(w + 5 * ldw, VL), v_x, VL);
+        if constexpr (ROWS > 6) c6 = VECTOR_FMACC_VV<T, LMUL>(c6, VECTOR_LOAD<T, LMUL>(w + 6 * ldw, VL), v_x, VL);
+        if constexpr (ROWS > 7) c7 = VECTOR_FMACC_VV<T, LMUL>(c7, VECTOR_LOAD<T, LMUL>(w + 7 * ldw, VL), v_x, VL);
+    }
+
+    auto v_xt = VECTOR_LOAD<T, LMUL>(x + k_full, vl_tail);
+    const T* wt = W + k_full;
+
+    if constexpr (ROWS > 0) y[0] = gemv_row_sum<T, LMUL>(c0, k_full ? VL : 0, wt + 0 * ldw, v_xt, vl_tail, accumulate ? y[0] : 0);
+    if constexpr (ROWS > 1) y[1] = gemv_row_sum<T, LMUL>(c1, k_full ? VL : 0, wt + 1 * ldw, v_xt, vl_tail, accumulate ? y[1] : 0);
+    if constexpr (ROWS > 2) y[2] = gemv_row_sum<T, LMUL>(c2, k_full ? VL : 0, wt + 2 * ldw, v_xt, vl_tail, accumulate ? y[2] : 0);
+    if constexpr (ROWS > 3) y[3] = gemv_row_sum<T, LMUL>(c3, k_full ? VL : 0, wt + 3 * ldw, v_xt, vl_tail, accumulate ? y[3] : 0);
+    if constexpr (ROWS > 4) y[4] = gemv_row_sum<T, LMUL>(c4, k_full ? VL : 0, wt + 4 * ldw, v_xt, vl_tail, accumulate ? y[4] : 0);
+    if constexpr (ROWS > 5) y[5] = gemv_row_sum<T, LMUL>(c5, k_full ? VL : 0, wt + 5 * ldw, v_xt, vl_tail, accumulate ? y[5] : 0);
+    if constexpr (ROWS > 6) y[6] = gemv_row_sum<T, LMUL>(c6, k_full ? VL : 0, wt + 6 * ldw, v_xt, vl_tail, accumulate ? y[6] : 0);
+    if constexpr (ROWS > 7) y[7] = gemv_row_sum<T, LMUL>(c7, k_full ? VL : 0, wt + 7 * ldw, v_xt, vl_tail, accumulate ? y[7] : 0);
+}
+
+template<typename T, int LMUL, size_t ROWS = GEMV_ROWS<LMUL>>
+inline void gemv_n_rows(size_t rows, size_t K, const T* W, ptrdiff_t ldw, const T* x, T* y, bool accumulate) {
+    if (rows == ROWS) {
+        gemv_n_block<T, LMUL, ROWS>(K, W, ldw, x, y, accumulate);
+    } else if constexpr (ROWS > 1) {
+        gemv_n_rows<T, LMUL, ROWS - 1>(rows, K, W, ldw, x, y, accumulate);
+    }
+}
+
+// y[N] (+)= W[N x K] * x[K], W rows contiguous along K
+template<typename T, int LMUL>
+inline void gemv_n(size_t N, size_t K, const T* W, ptrdiff_t ldw, const T* x, T* y, bool accumulate = false) {
+    constexpr size_t R = GEMV_ROWS<LMUL>;
+
+    for (size_t i = 0; i < N; i += R) {
+        gemv_n_rows<T, LMUL>(std::min(R, N - i), K, W + i * ldw, ldw, x, y + i, accumulate);
+    }
+}
+
+// y[N] (+)= x[K] * W[K x N], W rows contiguous along N
+template<typename T, int LMUL>
+inline void gemv_t(size_t N, size_t K, const T* W, ptrdiff_t ldw, const T* x, T* y, bool accumulate = false) {
+    constexpr size_t R = GEMV_ROWS<LMUL>;
+
+    for (size_t j = 0, vl; j < N; j += vl) {
+        vl = SET_VECTOR_LENGTH<T, LMUL>(N - j);
+
+        // Accumulator r collects the weight rows k = r (mod R): R independent FMA chains
+        auto v_zero = VECTOR_MOVE<T, LMUL>(static_cast<T>(0), vl);
+        decltype(v_zero) c0, c1, c2, c3, c4, c5, c6, c7;
+
+        c0 = accumulate ? VECTOR_LOAD<T, LMUL>(y + j, vl) : v_zero;
+        if constexpr (R > 1) c1 = v_zero;
+        if constexpr (R > 2) c2 = v_zero;
+        if constexpr (R > 3) c3 = v_zero;
+        if constexpr (R > 4) c4 = v_zero;
+        if constexpr (R > 5) c5 = v_zero;
+        if constexpr (R > 6) c6 = v_zero;
+        if constexpr (R > 7) c7 = v_zero;
+
+        const T* w = W + j;
+        size_t k = 0;
+        for (; k + R <= K; k += R) {
+            const T* wk = w + k * ldw;
+            c0 = VECTOR_FMACC_VF<T, LMUL>(c0, x[k], VECTOR_LOAD<T, LMUL>(wk, vl), vl);
+            if constexpr (R > 1) c1 = VECTOR_FMACC_VF<T, LMUL>(c1, x[k + 1], VECTOR_LOAD<T, LMUL>(wk + 1 * ldw, vl), vl);
+            if constexpr (R > 2) c2 = VECTOR_FMACC_VF<T, LMUL>(c2, x[k + 2], VECTOR_LOAD<T, LMUL>(wk + 2 * ldw, vl), vl);
+            if constexpr (R > 3) c3 = VECTOR_FMACC_VF<T, LMUL>(c3, x[k + 3], VECTOR_LOAD<T, LMUL>(wk + 3 * ldw, vl), vl);
+            if constexpr (R > 4) c4 = VECTOR_FMACC_VF<T, LMUL>(c4, x[k + 4], VECTOR_LOAD<T, LMUL>(wk + 4 * ldw, vl), vl);
+            if constexpr (R > 5) c5 = VECTOR_FMACC_VF<T, LMUL>(c5, x[k + 5], VECTOR_LOAD<T, LMUL>(wk + 5 * ldw, vl), vl);
+            if constexpr (R > 6) c6 = VECTOR_FMACC_VF<T, LMUL>(c6, x[k + 6], VECTOR_LOAD<T, LMUL>(wk + 6 * ldw, vl), vl);
+            if constexpr (R > 7) c7 = VECTOR_FMACC_VF<T, LMUL>(c7, x[k + 7], VECTOR_LOAD<T, LMUL>(wk + 7 * ldw, vl), vl);
+        }
+        for (; k < K; k++) {
+            c0 = VECTOR_FMACC_VF<T, LMUL>(c0, x[k], VECTOR_LOAD<T, LMUL>(w + k * ldw, vl), vl);
+        }
+
+        // Pairwise tree over the R partial sums
+        if constexpr (R > 4) {
+            c0 = VECTOR_ADD<T, LMUL>(c0, c4, vl);
+            if constexpr (R > 5) c1 = VECTOR_ADD<T, LMUL>(c1, c5, vl);
+            if constexpr (R > 6) c2 = VECTOR_ADD<T, LMUL>(c2, c6, vl);
+            if constexpr (R > 7) c3 = VECTOR_ADD<T, LMUL>(c3, c7, vl);
+        }
+        if constexpr (R > 2) {
+            c0 = VECTOR_ADD<T, LMUL>(c0, c2, vl);
+            if constexpr (R > 3) c1 = VECTOR_ADD<T, LMUL>(c1, c3, vl);
+        }
+        if constexpr (R > 1) c0 = VECTOR_ADD<T, LMUL>(c0, c1, vl);
+
+        VECTOR_STORE<T, LMUL>(y + j, c0, vl);
+    }
+}
+
+#endif // RVV_GEMV_HPP
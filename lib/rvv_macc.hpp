@@ -81,6 +81,65 @@ vint64m4_t __riscv_vmacc_vv_i64m4 (vint64m4_t vd, vint64m4_t vs1, vint64m4_t vs2
 vint64m4_t __riscv_vmacc_vx_i64m4 (vint64m4_t vd, int64_t rs1, vint64m4_t vs2, size_t vl);
 vint64m8_t __riscv_vmacc_vv_i64m8 (vint64m8_t vd, vint64m8_t vs1, vint64m8_t vs2, size_t vl);
 vint64m8_t __riscv_vmacc_vx_i64m8 (vint64m8_t vd, int64_t rs1, vint64m8_t vs2, size_t vl);
+
+vfloat32mf2_t __riscv_vfwmacc_vv_f32mf2 (vfloat32mf2_t vd, vfloat16mf4_t vs1, vfloat16mf4_t vs2, size_t vl);
+vfloat32mf2_t __riscv_vfwmacc_vf_f32mf2 (vfloat32mf2_t vd, float16_t vs1, vfloat16mf4_t vs2, size_t vl);
+vfloat32m1_t __riscv_vfwmacc_vv_f32m1 (vfloat32m1_t vd, vfloat16mf2_t vs1, vfloat16mf2_t vs2, size_t vl);
+vfloat32m1_t __riscv_vfwmacc_vf_f32m1 (vfloat32m1_t vd, float16_t vs1, vfloat16mf2_t vs2, size_t vl);
+vfloat32m2_t __riscv_vfwmacc_vv_f32m2 (vfloat32m2_t vd, vfloat16m1_t vs1, vfloat16m1_t vs2, size_t vl);
+vfloat32m2_t __riscv_vfwmacc_vf_f32m2 (vfloat32m2_t vd, float16_t vs1, vfloat16m1_t vs2, size_t vl);
+vfloat32m4_t __riscv_vfwmacc_vv_f32m4 (vfloat32m4_t vd, vfloat16m2_t vs1, vfloat16m2_t vs2, size_t vl);
+vfloat32m4_t __riscv_vfwmacc_vf_f32m4 (vfloat32m4_t vd, float16_t vs1, vfloat16m2_t vs2, size_t vl);
+vfloat32m8_t __riscv_vfwmacc_vv_f32m8 (vfloat32m8_t vd, vfloat16m4_t vs1, vfloat16m4_t vs2, size_t vl);
+vfloat32m8_t __riscv_vfwmacc_vf_f32m8 (vfloat32m8_t vd, float16_t vs1, vfloat16m4_t vs2, size_t vl);
+vfloat64m1_t __riscv_vfwmacc_vv_f64m1 (vfloat64m1_t vd, vfloat32mf2_t vs1, vfloat32mf2_t vs2, size_t vl);
+vfloat64m1_t __riscv_vfwmacc_vf_f64m1 (vfloat64m1_t vd, float32_t vs1, vfloat32mf2_t vs2, size_t vl);
+vfloat64m2_t __riscv_vfwmacc_vv_f64m2 (vfloat64m2_t vd, vfloat32m1_t vs1, vfloat32m1_t vs2, size_t vl);
+vfloat64m2_t __riscv_vfwmacc_vf_f64m2 (vfloat64m2_t vd, float32_t vs1, vfloat32m1_t vs2, size_t vl);
+vfloat64m4_t __riscv_vfwmacc_vv_f64m4 (vfloat64m4_t vd, vfloat32m2_t vs1, vfloat32m2_t vs2, size_t vl);
+vfloat64m4_t __riscv_vfwmacc_vf_f64m4 (vfloat64m4_t vd, float32_t vs1, vfloat32m2_t vs2, size_t vl);
+vfloat64m8_t __riscv_vfwmacc_vv_f64m8 (vfloat64m8_t vd, vfloat32m4_t vs1, vfloat32m4_t vs2, size_t vl);
+vfloat64m8_t __riscv_vfwmacc_vf_f64m8 (vfloat64m8_t vd, float32_t vs1, vfloat32m4_t vs2, size_t vl);
+
+vint16m1_t __riscv_vwmacc_vv_i16m1 (vint16m1_t vd, vint8mf2_t vs1, vint8mf2_t vs2, size_t vl);
+vint16m1_t __riscv_vwmacc_vx_i16m1 (vint16m1_t vd, int8_t rs1, vint8mf2_t vs2, size_t vl);
+vint16m2_t __riscv_vwmacc_vv_i16m2 (vint16m2_t vd, vint8m1_t vs1, vint8m1_t vs2, size_t vl);
+vint16m2_t __riscv_vwmacc_vx_i16m2 (vint16m2_t vd, int8_t rs1, vint8m1_t vs2, size_t vl);
+vint16m4_t __riscv_vwmacc_vv_i16m4 (vint16m4_t vd, vint8m2_t vs1, vint8m2_t vs2, size_t vl);
+vint16m4_t __riscv_vwmacc_vx_i16m4 (vint16m4_t vd, int8_t rs1, vint8m2_t vs2, size_t vl);
+vint16m8_t __riscv_vwmacc_vv_i16m8 (vint16m8_t vd, vint8m4_t vs1, vint8m4_t vs2, size_t vl);
+vint16m8_t __riscv_vwmacc_vx_i16m8 (vint16m8_t vd, int8_t rs1, vint8m4_t vs2, size_t vl);
+vint32m1_t __riscv_vwmacc_vv_i32m1 (vint32m1_t vd, vint16mf2_t vs1, vint16mf2_t vs2, size_t vl);
+vint32m1_t __riscv_vwmacc_vx_i32m1 (vint32m1_t vd, int16_t rs1, vint16mf2_t vs2, size_t vl);
+vint32m2_t __riscv_vwmacc_vv_i32m2 (vint32m2_t vd, vint16m1_t vs1, vint16m1_t vs2, size_t vl);
+vint32m2_t __riscv_vwmacc_vx_i32m2 (vint32m2_t vd, int16_t rs1, vint16m1_t vs2, size_t vl);
+vint32m4_t __riscv_vwmacc_vv_i32m4 (vint32m4_t vd, vint16m2_t vs1, vint16m2_t vs2, size_t vl);
+vint32m4_t __riscv_vwmacc_vx_i32m4 (vint32m4_t vd, int16_t rs1, vint16m2_t vs2, size_t vl);
+vint32m8_t __riscv_vwmacc_vv_i32m8 (vint32m8_t vd, vint16m4_t vs1, vint16m4_t vs2, size_t vl);
+vint32m8_t __riscv_vwmacc_vx_i32m8 (vint32m8_t vd, int16_t rs1, vint16m4_t vs2, size_t vl);
+
+vint16m1_t __riscv_vwmul_vv_i16m1 (vint8mf2_t vs2, vint8mf2_t vs1, size_t vl);
+vint16m1_t __riscv_vwmul_vx_i16m1 (vint8mf2_t vs2, int8_t rs1, size_t vl);
+vint16m2_t __riscv_vwmul_vv_i16m2 (vint8m1_t vs2, vint8m1_t vs1, size_t vl);
+vint16m2_t __riscv_vwmul_vx_i16m2 (vint8m1_t vs2, int8_t rs1, size_t vl);
+vint16m4_t __riscv_vwmul_vv_i16m4 (vint8m2_t vs2, vint8m2_t vs1, size_t vl);
+vint16m4_t __riscv_vwmul_vx_i16m4 (vint8m2_t vs2, int8_t rs1, size_t vl);
+vint16m8_t __riscv_vwmul_vv_i16m8 (vint8m4_t vs2, vint8m4_t vs1, size_t vl);
+vint16m8_t __riscv_vwmul_vx_i16m8 (vint8m4_t vs2, int8_t rs1, size_t vl);
+vint32m1_t __riscv_vwmul_vv_i32m1 (vint16mf2_t vs2, vint16mf2_t vs1, size_t vl);
+vint32m1_t __riscv_vwmul_vx_i32m1 (vint16mf2_t vs2, int16_t rs1, size_t vl);
+vint32m2_t __riscv_vwmul_vv_i32m2 (vint16m1_t vs2, vint16m1_t vs1, size_t vl);
+vint32m2_t __riscv_vwmul_vx_i32m2 (vint16m1_t vs2, int16_t rs1, size_t vl);
+vint32m4_t __riscv_vwmul_vv_i32m4 (vint16m2_t vs2, vint16m2_t vs1, size_t vl);
+vint32m4_t __riscv_vwmul_vx_i32m4 (vint16m2_t vs2, int16_t rs1, size_t vl);
+vint32m8_t __riscv_vwmul_vv_i32m8 (vint16m4_t vs2, vint16m4_t vs1, size_t vl);
+vint32m8_t __riscv_vwmul_vx_i32m8 (vint16m4_t vs2, int16_t rs1, size_t vl);
+vint64m2_t __riscv_vwmul_vv_i64m2 (vint32m1_t vs2, vint32m1_t vs1, size_t vl);
+vint64m2_t __riscv_vwmul_vx_i64m2 (vint32m1_t vs2, int32_t rs1, size_t vl);
+vint64m4_t __riscv_vwmul_vv_i64m4 (vint32m2_t vs2, vint32m2_t vs1, size_t vl);
+vint64m4_t __riscv_vwmul_vx_i64m4 (vint32m2_t vs2, int32_t rs1, size_t vl);
+vint64m8_t __riscv_vwmul_vv_i64m8 (vint32m4_t vs2, vint32m4_t vs1, size_t vl);
+vint64m8_t __riscv_vwmul_vx_i64m8 (vint32m4_t vs2, int32_t rs1, size_t vl);
 */
 
 template<typename T, int LMUL, typename VD, typename VS1, typename VS2>
@@ -202,4 +261,117 @@ inline auto VECTOR_FMADD_VF(VS1 vs1, T scalar, VD vd, size_t vl) {
     }
 }
 
+// Widening FMACC: vd (2*SEW, 2*LMUL) += vs1 * vs2, with T / LMUL naming the narrow sources
+// (e.g. T = _Float16, LMUL = M4 accumulates into vfloat32m8_t)
+template<typename T, int LMUL, typename VD, typename VS1, typename VS2>
+inline auto VECTOR_FWMACC_VV(VD vd, VS1 vs1, VS2 vs2, size_t vl) {
+    if constexpr (std::is_same_v<T, _Float16>) {
+        if constexpr (LMUL == MF4) return __riscv_vfwmacc_vv_f32mf2(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == MF2) return __riscv_vfwmacc_vv_f32m1(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vfwmacc_vv_f32m2(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vfwmacc_vv_f32m4(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vfwmacc_vv_f32m8(vd, vs1, vs2, vl);
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+        if constexpr (LMUL == MF2) return __riscv_vfwmacc_vv_f64m1(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vfwmacc_vv_f64m2(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vfwmacc_vv_f64m4(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vfwmacc_vv_f64m8(vd, vs1, vs2, vl);
+    }
+}
+
+template<typename T, int LMUL, typename VD, typename VS2>
+inline auto VECTOR_FWMACC_VF(VD vd, T rs1, VS2 vs2, size_t vl) {
+    if constexpr (std::is_same_v<T, _Float16>) {
+        if constexpr (LMUL == MF4) return __riscv_vfwmacc_vf_f32mf2(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == MF2) return __riscv_vfwmacc_vf_f32m1(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vfwmacc_vf_f32m2(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vfwmacc_vf_f32m4(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vfwmacc_vf_f32m8(vd, rs1, vs2, vl);
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+        if constexpr (LMUL == MF2) return __riscv_vfwmacc_vf_f64m1(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vfwmacc_vf_f64m2(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vfwmacc_vf_f64m4(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vfwmacc_vf_f64m8(vd, rs1, vs2, vl);
+    }
+}
+
+// Integer widening MACC: vd (2*SEW, 2*LMUL) += vs1 * vs2, with T / LMUL naming the narrow
+// signed sources (e.g. T = int16_t, LMUL = M2 accumulates into vint32m4_t)
+template<typename T, int LMUL, typename VD, typename VS1, typename VS2>
+inline auto VECTOR_WMACC_VV(VD vd, VS1 vs1, VS2 vs2, size_t vl) {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmacc_vv_i16m1(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmacc_vv_i16m2(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmacc_vv_i16m4(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmacc_vv_i16m8(vd, vs1, vs2, vl);
+    }
+    else if constexpr (std::is_same_v<T, int16_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmacc_vv_i32m1(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmacc_vv_i32m2(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmacc_vv_i32m4(vd, vs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmacc_vv_i32m8(vd, vs1, vs2, vl);
+    }
+}
+
+template<typename T, int LMUL, typename VD, typename VS2>
+inline auto VECTOR_WMACC_VX(VD vd, T rs1, VS2 vs2, size_t vl) {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmacc_vx_i16m1(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmacc_vx_i16m2(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmacc_vx_i16m4(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmacc_vx_i16m8(vd, rs1, vs2, vl);
+    }
+    else if constexpr (std::is_same_v<T, int16_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmacc_vx_i32m1(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmacc_vx_i32m2(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmacc_vx_i32m4(vd, rs1, vs2, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmacc_vx_i32m8(vd, rs1, vs2, vl);
+    }
+}
+
+// Integer widening multiply: returns vs2 * vs1 at 2*SEW, 2*LMUL (T / LMUL name the sources)
+template<typename T, int LMUL, typename VS2, typename VS1>
+inline auto VECTOR_WMUL_VV(VS2 vs2, VS1 vs1, size_t vl) {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmul_vv_i16m1(vs2, vs1, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmul_vv_i16m2(vs2, vs1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmul_vv_i16m4(vs2, vs1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmul_vv_i16m8(vs2, vs1, vl);
+    }
+    else if constexpr (std::is_same_v<T, int16_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmul_vv_i32m1(vs2, vs1, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmul_vv_i32m2(vs2, vs1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmul_vv_i32m4(vs2, vs1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmul_vv_i32m8(vs2, vs1, vl);
+    }
+    else if constexpr (std::is_same_v<T, int32_t>) {
+        if constexpr (LMUL == M1) return __riscv_vwmul_vv_i64m2(vs2, vs1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmul_vv_i64m4(vs2, vs1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmul_vv_i64m8(vs2, vs1, vl);
+    }
+}
+
+template<typename T, int LMUL, typename VS2>
+inline auto VECTOR_WMUL_VX(VS2 vs2, T rs1, size_t vl) {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmul_vx_i16m1(vs2, rs1, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmul_vx_i16m2(vs2, rs1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmul_vx_i16m4(vs2, rs1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmul_vx_i16m8(vs2, rs1, vl);
+    }
+    else if constexpr (std::is_same_v<T, int16_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vwmul_vx_i32m1(vs2, rs1, vl);
+        else if constexpr (LMUL == M1) return __riscv_vwmul_vx_i32m2(vs2, rs1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmul_vx_i32m4(vs2, rs1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmul_vx_i32m8(vs2, rs1, vl);
+    }
+    else if constexpr (std::is_same_v<T, int32_t>) {
+        if constexpr (LMUL == M1) return __riscv_vwmul_vx_i64m2(vs2, rs1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vwmul_vx_i64m4(vs2, rs1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vwmul_vx_i64m8(vs2, rs1, vl);
+    }
+}
+
 #endif // RVV_MACC_HPP
\ No newline at end of file
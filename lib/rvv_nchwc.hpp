@@ -0,0 +1,443 @@
+#ifndef RVV_NCHWC_HPP
+#define RVV_NCHWC_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+#include <pthread.h>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_conv_gemm.hpp"
+
+/*
+Blocked activation layout NCHW[c] (single image, float):
+
+    x[C][H][W]  ->  xb[ceil(C / cb)][H][W][cb],   channel c at block c / cb, lane c % cb
+
+With the channels of one pixel contiguous, one channel block is one unit-stride vector of
+cb lanes (cb = 8, 16, or the full VLMAX of the LMUL; cb <= SET_VECTOR_LENGTH_MAX<float, LMUL>,
+checked by the converters and every op, which throw std::invalid_argument otherwise).
+Per-channel operands (bias, BN scale / shift) become one vector load per block instead of
+a scalar per channel, and the conv accumulators hold cb output channels of one pixel, so
+neither the conv stores nor the pool / BN / activation passes need strided access.
+
+Lanes past C in the last block are zero after nchw_to_nchwc, and every op below keeps them
+zero (the per-channel operands are zero-padded to whole blocks), so a model converts once
+at its input and once at its output and runs all layers in between on blocked tensors.
+
+Conv weights are packed once per layer by nchwc_pack_weights into [C_out / cb][C_in][KH][KW][cb]:
+for each input tap one vector of cb output channels, broadcast-multiplied by one input
+scalar per output pixel.
+*/
+
+// Floats held by a C x H x W tensor in NCHW[cb]
+inline size_t nchwc_size(size_t channels, size_t height, size_t width, size_t cb) {
+    return (channels + cb - 1) / cb * cb * height * width;
+}
+
+// A block wider than one register group would silently drop its lanes past VLMAX
+template<int LMUL>
+inline void nchwc_check_block(size_t cb) {
+    if (cb == 0 || cb > SET_VECTOR_LENGTH_MAX<float, LMUL>()) {
+        throw std::invalid_argument("NCHWc block must be 1 .. VLMAX channels of the LMUL that runs it");
+    }
+}
+
+// NCHW -> NCHW[cb]: every channel is one unit-stride load and one stride-cb store
+template<int LMUL>
+inline void nchw_to_nchwc(const float* src, float* dst, size_t channels, size_t height, size_t width, size_t cb) {
+    nchwc_check_block<LMUL>(cb);
+    const size_t hw = height * width;
+    if (channels % cb != 0) {
+        float* last = dst + channels / cb * hw * cb;
+        std::memset(last, 0, hw * cb * sizeof(float));
+    }
+    for (size_t c = 0; c < channels; c++) {
+        const float* s = src + c * hw;
+        float* d = dst + (c / cb) * hw * cb + c % cb;
+        for (size_t i = 0, vl; i < hw; i += vl) {
+            vl = SET_VECTOR_LENGTH<float, LMUL>(hw - i);
+            auto v = VECTOR_LOAD<float, LMUL>(s + i, vl);
+            VECTOR_STRIDED_STORE<float, LMUL>(d + i * cb, cb * sizeof(float), v, vl);
+        }
+    }
+}
+
+// NCHW[cb] -> NCHW (padding lanes dropped)
+template<int LMUL>
+inline void nchwc_to_nchw(const float* src, float* dst, size_t channels, size_t height, size_t width, size_t cb) {
+    nchwc_check_block<LMUL>(cb);
+    const size_t hw = height * width;
+    for (size_t c = 0; c < channels; c++) {
+        const float* s = src + (c / cb) * hw * cb + c % cb;
+        float* d = dst + c * hw;
+        for (size_t i = 0, vl; i < hw; i += vl) {
+            vl = SET_VECTOR_LENGTH<float, LMUL>(hw - i);
+            auto v = VECTOR_STRIDED_LOAD<float, LMUL>(s + i * cb, cb * sizeof(float), vl);
+            VECTOR_STORE<float, LMUL>(d + i, v, vl);
+        }
+    }
+}
+
+// Per-channel operand zero-padded to whole blocks (empty if p is null)
+inline std::vector<float> nchwc_pad_channels(const float* p, size_t channels, size_t cb) {
+    if (!p) return {};
+    std::vector<float> out((channels + cb - 1) / cb * cb, 0.0f);
+    std::copy(p, p + channels, out.begin());
+    return out;
+}
+
+// Floats of the packed weights of an out x in x kh x kw conv
+inline size_t nchwc_weights_size(size_t out_channels, size_t in_channels,
+                                 size_t kernel_h, size_t kernel_w, size_t cb) {
+    return (out_channels + cb - 1) / cb * cb * in_channels * kernel_h * kernel_w;
+}
+
+// [OC][IC][KH][KW] -> [OC / cb][IC][KH][KW][cb], missing output channels zero
+inline void nchwc_pack_weights(const float* weights, float* dst, size_t out_channels, size_t in_channels,
+                               size_t kernel_h, size_t kernel_w, size_t cb) {
+    const size_t taps = in_channels * kernel_h * kernel_w;
+    std::memset(dst, 0, nchwc_weights_size(out_channels, in_channels, kernel_h, kernel_w, cb) * sizeof(float));
+    for (size_t oc = 0; oc < out_channels; oc++) {
+        float* d = dst + (oc / cb) * taps * cb + oc % cb;
+        const float* s = weights + oc * taps;
+        for (size_t t = 0; t < taps; t++) d[t * cb] = s[t];
+    }
+}
+
+// Epilogue on the cb output channels of one pixel. Unlike gemm_epilogue_apply the operands
+// are per lane: bias / scale / shift point at the block's first channel (zero-padded arrays),
+// residual is an NCHW[cb] tensor of the output's shape and off the element offset of the pixel.
+template<int LMUL, unsigned EP, typename VecType>
+inline VecType nchwc_epilogue_apply(VecType v, const GemmEpilogue<float>& ep, size_t c0, size_t off, size_t vl) {
+    static_assert(((EP & GEMM_EP_RELU) != 0) + ((EP & GEMM_EP_LEAKY_RELU) != 0) + ((EP & GEMM_EP_CLIP) != 0) <= 1,
+                  "at most one activation per epilogue");
+
+    if constexpr ((EP & GEMM_EP_BIAS) != 0) {
+        v = VECTOR_ADD<float, LMUL>(v, VECTOR_LOAD<float, LMUL>(ep.bias + c0, vl), vl);
+    }
+    if constexpr ((EP & GEMM_EP_SCALE_SHIFT) != 0) {
+        v = VECTOR_FMACC_VV<float, LMUL>(VECTOR_LOAD<float, LMUL>(ep.shift + c0, vl),
+                                         VECTOR_LOAD<float, LMUL>(ep.scale + c0, vl), v, vl);
+    }
+    if constexpr ((EP & GEMM_EP_RESIDUAL) != 0) {
+        v = VECTOR_ADD<float, LMUL>(v, VECTOR_LOAD<float, LMUL>(ep.residual + off, vl), vl);
+    }
+    if constexpr ((EP & GEMM_EP_RELU) != 0) {
+        v = VECTOR_MAX<float, LMUL>(v, 0.0f, vl);
+    }
+    if constexpr ((EP & GEMM_EP_LEAKY_RELU) != 0) {
+        auto v_neg = VECTOR_MIN<float, LMUL>(v, 0.0f, vl);
+        v = VECTOR_MAX<float, LMUL>(v, 0.0f, vl);
+        v = VECTOR_FMACC_VF<float, LMUL>(v, ep.alpha, v_neg, vl);
+    }
+    if constexpr ((EP & GEMM_EP_CLIP) != 0) {
+        v = VECTOR_MAX<float, LMUL>(v, ep.clip_min, vl);
+        v = VECTOR_MIN<float, LMUL>(v, ep.clip_max, vl);
+    }
+    return v;
+}
+
+// Output pixels per conv register block: ROWS accumulators + 1 weight group in 32 registers
+template<int LMUL>
+constexpr size_t NCHWC_ROWS = (LMUL == M8) ? 3 : (LMUL == M4) ? 6 : 8;
+
+// ROWS consecutive output pixels (oh, ow0 ..) of one output channel block. Interior pixels
+// (all taps inside the image, see conv_interior_cols) read their taps unchecked; BORDER
+// pixels go one at a time and skip the taps outside the image.
+template<int LMUL, size_t ROWS, unsigned EP, bool BORDER>
+inline void conv2d_nchwc_block(const float* input, const float* w_blk, float* out_px,
+                               const ConvGemmShape& s, size_t oh, size_t ow0, size_t cb,
+                               size_t c0, size_t off, const GemmEpilogue<float>* ep) {
+    static_assert(ROWS >= 1 && ROWS <= 8, "1 to 8 output pixels per block");
+    static_assert(!BORDER || ROWS == 1, "border pixels go one at a time");
+
+    const ptrdiff_t H = (ptrdiff_t)s.in_h, W = (ptrdiff_t)s.in_w;
+    const size_t plane = s.in_h * s.in_w * cb;
+    const size_t step = s.stride_w * cb;
+    const size_t vl = cb;
+
+    // Only the ROWS live accumulators are initialised; the rest are never touched
+    decltype(VECTOR_MOVE<float, LMUL>(0.0f, vl)) c0v, c1v, c2v, c3v, c4v, c5v, c6v, c7v;
+    {
+        auto v_zero = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+        c0v = v_zero;
+        if constexpr (ROWS > 1) c1v = v_zero;
+        if constexpr (ROWS > 2) c2v = v_zero;
+        if constexpr (ROWS > 3) c3v = v_zero;
+        if constexpr (ROWS > 4) c4v = v_zero;
+        if constexpr (ROWS > 5) c5v = v_zero;
+        if constexpr (ROWS > 6) c6v = v_zero;
+        if constexpr (ROWS > 7) c7v = v_zero;
+    }
+
+    const ptrdiff_t iw0 = (ptrdiff_t)(ow0 * s.stride_w) - (ptrdiff_t)s.pad_w;
+
+    for (size_t ic = 0; ic < s.in_channels; ic++) {
+        const float* in_c = input + (ic / cb) * plane + ic % cb;
+        const float* w_ic = w_blk + ic * s.kernel_h * s.kernel_w * cb;
+
+        for (size_t kh = 0; kh < s.kernel_h; kh++) {
+            ptrdiff_t ih = (ptrdiff_t)(oh * s.stride_h + kh * s.dil_h) - (ptrdiff_t)s.pad_h;
+            if (ih < 0 || ih >= H) continue;
+            const float* row = in_c + ih * W * cb;
+
+            for (size_t kw = 0; kw < s.kernel_w; kw++) {
+                const ptrdiff_t iw = iw0 + (ptrdiff_t)(kw * s.dil_w);
+                if constexpr (BORDER) {
+                    if (iw < 0 || iw >= W) continue;
+                }
+                auto v_w = VECTOR_LOAD<float, LMUL>(w_ic + (kh * s.kernel_w + kw) * cb, vl);
+                const float* px = row + iw * (ptrdiff_t)cb;
+
+                c0v = VECTOR_FMACC_VF<float, LMUL>(c0v, px[0], v_w, vl);
+                if constexpr (ROWS > 1) c1v = VECTOR_FMACC_VF<float, LMUL>(c1v, px[step], v_w, vl);
+                if constexpr (ROWS > 2) c2v = VECTOR_FMACC_VF<float, LMUL>(c2v, px[2 * step], v_w, vl);
+                if constexpr (ROWS > 3) c3v = VECTOR_FMACC_VF<float, LMUL>(c3v, px[3 * step], v_w, vl);
+                if constexpr (ROWS > 4) c4v = VECTOR_FMACC_VF<float, LMUL>(c4v, px[4 * step], v_w, vl);
+                if constexpr (ROWS > 5) c5v = VECTOR_FMACC_VF<float, LMUL>(c5v, px[5 * step], v_w, vl);
+                if constexpr (ROWS > 6) c6v = VECTOR_FMACC_VF<float, LMUL>(c6v, px[6 * step], v_w, vl);
+                if constexpr (ROWS > 7) c7v = VECTOR_FMACC_VF<float, LMUL>(c7v, px[7 * step], v_w, vl);
+            }
+        }
+    }
+
+    auto store = [&](auto v, size_t r) {
+        if constexpr (EP != GEMM_EP_NONE) {
+            v = nchwc_epilogue_apply<LMUL, EP>(v, *ep, c0, off + r * cb, vl);
+        }
+        VECTOR_STORE<float, LMUL>(out_px + r * cb, v, vl);
+    };
+    store(c0v, 0);
+    if constexpr (ROWS > 1) store(c1v, 1);
+    if constexpr (ROWS > 2) store(c2v, 2);
+    if constexpr (ROWS > 3) store(c3v, 3);
+    if constexpr (ROWS > 4) store(c4v, 4);
+    if constexpr (ROWS > 5) store(c5v, 5);
+    if constexpr (ROWS > 6) store(c6v, 6);
+    if constexpr (ROWS > 7) store(c7v, 7);
+}
+
+// Output rows [row_first, row_last) of the flattened (output block, oh) space
+template<int LMUL, unsigned EP>
+inline void conv2d_nchwc_run(const float* input, const float* w_packed, float* output,
+                             const ConvGemmShape& s, size_t cb, size_t row_first, size_t row_last,
+                             const GemmEpilogue<float>* ep) {
+    constexpr size_t R = NCHWC_ROWS<LMUL>;
+    const size_t out_h = s.out_h(), out_w = s.out_w();
+    const size_t w_blk_size = s.K() * cb;
+
+    size_t lo, hi;
+    conv_interior_cols(s, lo, hi);
+
+    for (size_t row = row_first; row < row_last; row++) {
+        const size_t ob = row / out_h, oh = row % out_h;
+        const float* w_blk = w_packed + ob * w_blk_size;
+        const size_t off = (ob * out_h + oh) * out_w * cb;
+        float* out_row = output + off;
+
+        size_t ow = 0;
+        for (; ow < lo; ow++) {
+            conv2d_nchwc_block<LMUL, 1, EP, true>(input, w_blk, out_row + ow * cb, s, oh, ow, cb, ob * cb, off + ow * cb, ep);
+        }
+        for (; ow + R <= hi; ow += R) {
+            conv2d_nchwc_block<LMUL, R, EP, false>(input, w_blk, out_row + ow * cb, s, oh, ow, cb, ob * cb, off + ow * cb, ep);
+        }
+        for (; ow < hi; ow++) {
+            conv2d_nchwc_block<LMUL, 1, EP, false>(input, w_blk, out_row + ow * cb, s, oh, ow, cb, ob * cb, off + ow * cb, ep);
+        }
+        for (; ow < out_w; ow++) {
+            conv2d_nchwc_block<LMUL, 1, EP, true>(input, w_blk, out_row + ow * cb, s, oh, ow, cb, ob * cb, off + ow * cb, ep);
+        }
+    }
+}
+
+struct ConvNchwcThreadCtx {
+    const float* input;
+    const float* w_packed;
+    float* output;
+    const ConvGemmShape* s;
+    size_t cb;
+    size_t row_first, row_last;
+    const GemmEpilogue<float>* ep;
+};
+
+template<int LMUL, unsigned EP>
+inline void* conv2d_nchwc_worker(void* p) {
+    auto* ctx = static_cast<ConvNchwcThreadCtx*>(p);
+    conv2d_nchwc_run<LMUL, EP>(ctx->input, ctx->w_packed, ctx->output, *ctx->s, ctx->cb,
+                               ctx->row_first, ctx->row_last, ctx->ep);
+    return nullptr;
+}
+
+// Direct conv on NCHW[cb] tensors, weights packed by nchwc_pack_weights. The epilogue
+// operands are per-channel arrays zero-padded to whole blocks (nchwc_pad_channels).
+// Output rows of all channel blocks are split across gemm_get_num_threads() workers.
+template<int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void conv2d_nchwc(const float* input, const float* w_packed, float* output,
+                         const ConvGemmShape& s, size_t out_channels, size_t cb,
+                         const GemmEpilogue<float>* ep = nullptr) {
+    nchwc_check_block<LMUL>(cb);
+    const size_t out_h = s.out_h(), out_w = s.out_w();
+    const size_t rows = (out_channels + cb - 1) / cb * out_h;
+    if (rows == 0 || out_w == 0) return;
+
+    int nt = gemm_get_num_threads();
+    if (out_channels * out_h * out_w * s.K() < (size_t)GEMM_MT_MIN_WORK) nt = 1;
+    nt = (int)std::min((size_t)std::max(nt, 1), rows);
+
+    if (nt == 1) {
+        conv2d_nchwc_run<LMUL, EP>(input, w_packed, output, s, cb, 0, rows, ep);
+        return;
+    }
+
+    std::vector<ConvNchwcThreadCtx> ctx(nt);
+    std::vector<pthread_t> threads(nt);
+    std::vector<bool> running(nt, false);
+
+    for (int t = 0; t < nt; t++) {
+        ctx[t] = {input, w_packed, output, &s, cb, rows * t / nt, rows * (t + 1) / nt, ep};
+    }
+    for (int t = 1; t < nt; t++) {
+        running[t] = pthread_create(&threads[t], nullptr, conv2d_nchwc_worker<LMUL, EP>, &ctx[t]) == 0;
+    }
+
+    conv2d_nchwc_worker<LMUL, EP>(&ctx[0]);
+    for (int t = 1; t < nt; t++) {
+        if (running[t]) {
+            pthread_join(threads[t], nullptr);
+        } else {
+            conv2d_nchwc_worker<LMUL, EP>(&ctx[t]);
+        }
+    }
+}
+
+// Input range [lo, hi) of a pool window starting at i0 (may be negative), clamped to the
+// input and never empty: a window wholly in the padding takes the nearest edge pixel, so no
+// -FLT_MAX sentinel can reach the output.
+inline void maxpool_nchwc_window(ptrdiff_t i0, size_t k, size_t in, size_t& lo, size_t& hi) {
+    const ptrdiff_t n = (ptrdiff_t)in;
+    const ptrdiff_t l = std::min(std::max(i0, (ptrdiff_t)0), n - 1);
+    lo = (size_t)l;
+    hi = (size_t)std::max(std::min(i0 + (ptrdiff_t)k, n), l + 1);
+}
+
+// Max pool on NCHW[cb]: the cb channels of a window tap are one vector. out_h / out_w are
+// explicit so that asymmetric (end-only) padding works; taps outside the input are skipped.
+template<int LMUL>
+inline void maxpool_nchwc(const float* input, float* output, size_t channels,
+                          size_t in_h, size_t in_w, size_t out_h, size_t out_w,
+                          size_t k_h, size_t k_w, size_t stride_h, size_t stride_w,
+                          size_t pad_h, size_t pad_w, size_t cb) {
+    nchwc_check_block<LMUL>(cb);
+    const size_t blocks = (channels + cb - 1) / cb;
+    const size_t vl = cb;
+
+    for (size_t b = 0; b < blocks; b++) {
+        const float* in_b = input + b * in_h * in_w * cb;
+        float* out_b = output + b * out_h * out_w * cb;
+
+        for (size_t oh = 0; oh < out_h; oh++) {
+            size_t h_lo, h_hi;
+            maxpool_nchwc_window((ptrdiff_t)(oh * stride_h) - (ptrdiff_t)pad_h, k_h, in_h, h_lo, h_hi);
+
+            for (size_t ow = 0; ow < out_w; ow++) {
+                size_t w_lo, w_hi;
+                maxpool_nchwc_window((ptrdiff_t)(ow * stride_w) - (ptrdiff_t)pad_w, k_w, in_w, w_lo, w_hi);
+
+                // The window holds at least one input pixel, so the first tap seeds the max
+                auto v_max = VECTOR_LOAD<float, LMUL>(in_b + (h_lo * in_w + w_lo) * cb, vl);
+                for (size_t ih = h_lo; ih < h_hi; ih++) {
+                    const float* row = in_b + ih * in_w * cb;
+                    for (size_t iw = w_lo; iw < w_hi; iw++) {
+                        v_max = VECTOR_MAX<float, LMUL>(v_max, VECTOR_LOAD<float, LMUL>(row + iw * cb, vl), vl);
+                    }
+                }
+                VECTOR_STORE<float, LMUL>(out_b + (oh * out_w + ow) * cb, v_max, vl);
+            }
+        }
+    }
+}
+
+// y = x * scale[c] + shift[c] over NCHW[cb], scale / shift zero-padded to whole blocks
+template<int LMUL>
+inline void scale_shift_nchwc(const float* input, float* output, const float* scale, const float* shift,
+                              size_t channels, size_t height, size_t width, size_t cb) {
+    nchwc_check_block<LMUL>(cb);
+    const size_t blocks = (channels + cb - 1) / cb;
+    const size_t hw = height * width;
+    const size_t vl = cb;
+
+    for (size_t b = 0; b < blocks; b++) {
+        auto v_shift = VECTOR_LOAD<float, LMUL>(shift + b * cb, vl);
+        const float* in_b = input + b * hw * cb;
+        float* out_b = output + b * hw * cb;
+
+        if (scale) {
+            auto v_scale = VECTOR_LOAD<float, LMUL>(scale + b * cb, vl);
+            for (size_t i = 0; i < hw; i++) {
+                auto v = VECTOR_LOAD<float, LMUL>(in_b + i * cb, vl);
+                VECTOR_STORE<float, LMUL>(out_b + i * cb, VECTOR_FMACC_VV<float, LMUL>(v_shift, v_scale, v, vl), vl);
+            }
+        } else {
+            for (size_t i = 0; i < hw; i++) {
+                auto v = VECTOR_LOAD<float, LMUL>(in_b + i * cb, vl);
+                VECTOR_STORE<float, LMUL>(out_b + i * cb, VECTOR_ADD<float, LMUL>(v, v_shift, vl), vl);
+            }
+        }
+    }
+}
+
+// Bias add on NCHW[cb]
+template<int LMUL>
+inline void bias_add_nchwc(const float* input, const float* bias, float* output,
+                           size_t channels, size_t height, size_t width, size_t cb) {
+    std::vector<float> b = nchwc_pad_channels(bias, channels, cb);
+    scale_shift_nchwc<LMUL>(input, output, nullptr, b.data(), channels, height, width, cb);
+}
+
+// Inference batch norm on NCHW[cb], folded into one scale / shift vector per block
+template<int LMUL>
+inline void batch_norm_nchwc(const float* input, float* output, const float* scale, const float* bias,
+                             const float* mean, const float* variance,
+                             size_t channels, size_t height, size_t width, float epsilon, size_t cb) {
+    std::vector<float> a((channels + cb - 1) / cb * cb, 0.0f), b(a.size(), 0.0f);
+    for (size_t c = 0; c < channels; c++) {
+        a[c] = scale[c] / std::sqrt(variance[c] + epsilon);
+        b[c] = bias[c] - mean[c] * a[c];
+    }
+    scale_shift_nchwc<LMUL>(input, output, a.data(), b.data(), channels, height, width, cb);
+}
+
+// Activations are element-wise: NCHW[cb] is processed as one flat array, and relu / leaky
+// relu of the zero padding lanes stays zero.
+template<int LMUL>
+inline void relu_nchwc(const float* input, float* output, size_t channels, size_t height, size_t width, size_t cb) {
+    const size_t n = nchwc_size(channels, height, width, cb);
+    for (size_t i = 0, vl; i < n; i += vl) {
+        vl = SET_VECTOR_LENGTH<float, LMUL>(n - i);
+        auto v = VECTOR_LOAD<float, LMUL>(input + i, vl);
+        VECTOR_STORE<float, LMUL>(output + i, VECTOR_MAX<float, LMUL>(v, 0.0f, vl), vl);
+    }
+}
+
+template<int LMUL>
+inline void leaky_relu_nchwc(const float* input, float* output, size_t channels, size_t height, size_t width,
+                             float alpha, size_t cb) {
+    const size_t n = nchwc_size(channels, height, width, cb);
+    for (size_t i = 0, vl; i < n; i += vl) {
+        vl = SET_VECTOR_LENGTH<float, LMUL>(n - i);
+        auto v = VECTOR_LOAD<float, LMUL>(input + i, vl);
+        auto v_neg = VECTOR_MIN<float, LMUL>(v, 0.0f, vl);
+        v = VECTOR_MAX<float, LMUL>(v, 0.0f, vl);
+        VECTOR_STORE<float, LMUL>(output + i, VECTOR_FMACC_VF<float, LMUL>(v, alpha, v_neg, vl), vl);
+    }
+}
+
+#endif // RVV_NCHWC_HPP
@@ -45,8 +45,10 @@ inline size_t SET_VECTOR_LENGTH(size_t avl) {
         else if constexpr (LMUL == M4) return __riscv_vsetvl_e64m4(avl);
         else if constexpr (LMUL == M8) return __riscv_vsetvl_e64m8(avl);
     }
-    else if constexpr (std::is_same_v<T, int16_t>) {
-        if constexpr (LMUL == M1) return __riscv_vsetvl_e16m1(avl);
+    else if constexpr (std::is_same_v<T, _Float16> || std::is_same_v<T, int16_t>) {
+        if constexpr (LMUL == MF4) return __riscv_vsetvl_e16mf4(avl);
+        else if constexpr (LMUL == MF2) return __riscv_vsetvl_e16mf2(avl);
+        else if constexpr (LMUL == M1) return __riscv_vsetvl_e16m1(avl);
         else if constexpr (LMUL == M2) return __riscv_vsetvl_e16m2(avl);
         else if constexpr (LMUL == M4) return __riscv_vsetvl_e16m4(avl);
         else if constexpr (LMUL == M8) return __riscv_vsetvl_e16m8(avl);
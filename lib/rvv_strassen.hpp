@@ -0,0 +1,149 @@
+#ifndef RVV_STRASSEN_HPP
+#define RVV_STRASSEN_HPP
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <riscv_vector.h>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+
+/*
+Strassen-Winograd driver:  C[M x N] = A[M x K] * B[K x N]
+
+Each level splits A, B and C into 2 x 2 quadrants and forms C from 7 half-size products
+and 15 quadrant additions (Winograd's variant) instead of 8 products, recursing until a
+dimension drops to the cutoff, where the packed GEMM engine (lib/rvv_gemm.hpp) takes over.
+Odd dimensions are peeled: the even leading part recurses and the last row / column /
+rank-1 term are added by the engine directly on strided views.
+
+Per level the schedule needs three temporaries, X [M/2 x K/2], Y [K/2 x N/2] and
+Z [M/2 x N/2]; the C quadrants hold the remaining partial products. All temporaries of
+all levels are carved from one arena sized up front, so the recursion never allocates.
+
+Strassen trades a few bits of accuracy for the saved products: the error bound grows with
+the recursion depth, so compare against matmul_scalar before enabling it for a workload.
+*/
+
+#ifndef STRASSEN_CUTOFF
+#define STRASSEN_CUTOFF 128
+#endif
+
+// Z = X + Y / Z = X - Y over an m x n block with leading dimensions ldx, ldy, ldz
+template<typename T, int LMUL, bool SUB>
+inline void strassen_add(size_t m, size_t n, const T* X, size_t ldx, const T* Y, size_t ldy,
+                         T* Z, size_t ldz) {
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n;) {
+            size_t vl = SET_VECTOR_LENGTH<T, LMUL>(n - j);
+            auto v_x = VECTOR_LOAD<T, LMUL>(X + i * ldx + j, vl);
+            auto v_y = VECTOR_LOAD<T, LMUL>(Y + i * ldy + j, vl);
+            if constexpr (SUB) {
+                VECTOR_STORE<T, LMUL>(Z + i * ldz + j, VECTOR_SUB<T, LMUL>(v_x, v_y, vl), vl);
+            } else {
+                VECTOR_STORE<T, LMUL>(Z + i * ldz + j, VECTOR_ADD<T, LMUL>(v_x, v_y, vl), vl);
+            }
+            j += vl;
+        }
+    }
+}
+
+inline bool strassen_is_leaf(size_t M, size_t N, size_t K, size_t cutoff) {
+    return M <= cutoff || N <= cutoff || K <= cutoff || M < 2 || N < 2 || K < 2;
+}
+
+// Arena elements needed below (and including) a level of size M x N x K
+inline size_t strassen_workspace_size(size_t M, size_t N, size_t K, size_t cutoff) {
+    if (strassen_is_leaf(M, N, K, cutoff)) return 0;
+
+    size_t m2 = M / 2, n2 = N / 2, k2 = K / 2;
+    return m2 * k2 + k2 * n2 + m2 * n2 + strassen_workspace_size(m2, n2, k2, cutoff);
+}
+
+template<typename T, int LMUL>
+inline void strassen_recursive(size_t M, size_t N, size_t K,
+                               const T* A, size_t lda, const T* B, size_t ldb,
+                               T* C, size_t ldc, size_t cutoff, T* arena) {
+    if (strassen_is_leaf(M, N, K, cutoff)) {
+        gemm_packed_strided<T, LMUL>(M, N, K, A, lda, 1, B, ldb, 1, C, ldc);
+        return;
+    }
+
+    const size_t m = M & ~(size_t)1, n = N & ~(size_t)1, k = K & ~(size_t)1;
+    const size_t m2 = m / 2, n2 = n / 2, k2 = k / 2;
+
+    const T* A11 = A;           const T* A12 = A + k2;
+    const T* A21 = A + m2 * lda; const T* A22 = A21 + k2;
+    const T* B11 = B;           const T* B12 = B + n2;
+    const T* B21 = B + k2 * ldb; const T* B22 = B21 + n2;
+    T* C11 = C;                 T* C12 = C + n2;
+    T* C21 = C + m2 * ldc;      T* C22 = C21 + n2;
+
+    T* X = arena;               // m2 x k2
+    T* Y = X + m2 * k2;         // k2 x n2
+    T* Z = Y + k2 * n2;         // m2 x n2
+    T* next = Z + m2 * n2;
+
+    // P7 = (A11 - A21)(B22 - B12) -> C21
+    strassen_add<T, LMUL, true>(m2, k2, A11, lda, A21, lda, X, k2);
+    strassen_add<T, LMUL, true>(k2, n2, B22, ldb, B12, ldb, Y, n2);
+    strassen_recursive<T, LMUL>(m2, n2, k2, X, k2, Y, n2, C21, ldc, cutoff, next);
+
+    // S1 = A21 + A22, T1 = B12 - B11, P5 = S1 T1 -> C22
+    strassen_add<T, LMUL, false>(m2, k2, A21, lda, A22, lda, X, k2);
+    strassen_add<T, LMUL, true>(k2, n2, B12, ldb, B11, ldb, Y, n2);
+    strassen_recursive<T, LMUL>(m2, n2, k2, X, k2, Y, n2, C22, ldc, cutoff, next);
+
+    // S2 = S1 - A11, T2 = B22 - T1, P6 = S2 T2 -> C12
+    strassen_add<T, LMUL, true>(m2, k2, X, k2, A11, lda, X, k2);
+    strassen_add<T, LMUL, true>(k2, n2, B22, ldb, Y, n2, Y, n2);
+    strassen_recursive<T, LMUL>(m2, n2, k2, X, k2, Y, n2, C12, ldc, cutoff, next);
+
+    // P1 = A11 B11 -> Z;  U2 = P1 + P6 -> C12
+    strassen_recursive<T, LMUL>(m2, n2, k2, A11, lda, B11, ldb, Z, n2, cutoff, next);
+    strassen_add<T, LMUL, false>(m2, n2, C12, ldc, Z, n2, C12, ldc);
+
+    // C11 = P1 + P2, P2 = A12 B21
+    strassen_recursive<T, LMUL>(m2, n2, k2, A12, lda, B21, ldb, C11, ldc, cutoff, next);
+    strassen_add<T, LMUL, false>(m2, n2, C11, ldc, Z, n2, C11, ldc);
+
+    // U3 = U2 + P7 -> C21, U4 = U2 + P5 -> C12, C22 = U3 + P5
+    strassen_add<T, LMUL, false>(m2, n2, C12, ldc, C21, ldc, C21, ldc);
+    strassen_add<T, LMUL, false>(m2, n2, C12, ldc, C22, ldc, C12, ldc);
+    strassen_add<T, LMUL, false>(m2, n2, C21, ldc, C22, ldc, C22, ldc);
+
+    // S4 = A12 - S2, C12 = U4 + S4 B22
+    strassen_add<T, LMUL, true>(m2, k2, A12, lda, X, k2, X, k2);
+    strassen_recursive<T, LMUL>(m2, n2, k2, X, k2, B22, ldb, Z, n2, cutoff, next);
+    strassen_add<T, LMUL, false>(m2, n2, C12, ldc, Z, n2, C12, ldc);
+
+    // T4 = T2 - B21, C21 = U3 - A22 T4
+    strassen_add<T, LMUL, true>(k2, n2, Y, n2, B21, ldb, Y, n2);
+    strassen_recursive<T, LMUL>(m2, n2, k2, A22, lda, Y, n2, Z, n2, cutoff, next);
+    strassen_add<T, LMUL, true>(m2, n2, C21, ldc, Z, n2, C21, ldc);
+
+    // Odd dimensions: rank-1 term of the last k, then the last column and row of C
+    if (K > k) {
+        gemm_packed_strided<T, LMUL>(m, n, 1, A + k, lda, 1, B + k * ldb, ldb, 1, C, ldc, true);
+    }
+    if (N > n) {
+        gemm_packed_strided<T, LMUL>(M, 1, K, A, lda, 1, B + n, ldb, 1, C + n, ldc);
+    }
+    if (M > m) {
+        gemm_packed_strided<T, LMUL>(1, n, K, A + m * lda, lda, 1, B, ldb, 1, C + m * ldc, ldc);
+    }
+}
+
+// Row-major, densely stored A[M x K], B[K x N], C[M x N]. Problems at or below the cutoff
+// in any dimension go straight to the packed engine.
+template<typename T, int LMUL>
+inline void gemm_strassen(const T* A, const T* B, T* C, size_t M, size_t N, size_t K,
+                          size_t cutoff = STRASSEN_CUTOFF) {
+    if (M == 0 || N == 0) return;
+    cutoff = std::max(cutoff, (size_t)1);
+
+    std::vector<T> arena(strassen_workspace_size(M, N, K, cutoff));
+    strassen_recursive<T, LMUL>(M, N, K, A, K, B, N, C, N, cutoff, arena.data());
+}
+
+#endif // RVV_STRASSEN_HPP
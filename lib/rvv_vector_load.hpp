@@ -85,7 +85,15 @@ vint64m8_t __riscv_vlse64_v_i64m8 (const int64_t *base, ptrdiff_t bstride, size_
 
 template<typename T, int LMUL>
 inline auto VECTOR_LOAD(const T* base, size_t vl) {
-    if constexpr (std::is_same_v<T, float>) {
+    if constexpr (std::is_same_v<T, _Float16>) {
+        if constexpr (LMUL == MF4) return __riscv_vle16_v_f16mf4(base, vl);
+        else if constexpr (LMUL == MF2) return __riscv_vle16_v_f16mf2(base, vl);
+        else if constexpr (LMUL == M1) return __riscv_vle16_v_f16m1(base, vl);
+        else if constexpr (LMUL == M2) return __riscv_vle16_v_f16m2(base, vl);
+        else if constexpr (LMUL == M4) return __riscv_vle16_v_f16m4(base, vl);
+        else if constexpr (LMUL == M8) return __riscv_vle16_v_f16m8(base, vl);
+    }
+    else if constexpr (std::is_same_v<T, float>) {
         if constexpr (LMUL == M1) return __riscv_vle32_v_f32m1(base, vl);
         else if constexpr (LMUL == M2) return __riscv_vle32_v_f32m2(base, vl);
         else if constexpr (LMUL == M4) return __riscv_vle32_v_f32m4(base, vl);
@@ -151,7 +159,15 @@ inline auto VECTOR_LOAD(const T* base, size_t vl) {
 
 template<typename T, int LMUL>
 inline auto VECTOR_STRIDED_LOAD(const T* base, ptrdiff_t stride, size_t vl) {
-    if constexpr (std::is_same_v<T, float>) {
+    if constexpr (std::is_same_v<T, _Float16>) {
+        if constexpr (LMUL == MF4) return __riscv_vlse16_v_f16mf4(base, stride, vl);
+        else if constexpr (LMUL == MF2) return __riscv_vlse16_v_f16mf2(base, stride, vl);
+        else if constexpr (LMUL == M1) return __riscv_vlse16_v_f16m1(base, stride, vl);
+        else if constexpr (LMUL == M2) return __riscv_vlse16_v_f16m2(base, stride, vl);
+        else if constexpr (LMUL == M4) return __riscv_vlse16_v_f16m4(base, stride, vl);
+        else if constexpr (LMUL == M8) return __riscv_vlse16_v_f16m8(base, stride, vl);
+    }
+    else if constexpr (std::is_same_v<T, float>) {
         if constexpr (LMUL == M1) return __riscv_vlse32_v_f32m1(base, stride, vl);
         else if constexpr (LMUL == M2) return __riscv_vlse32_v_f32m2(base, stride, vl);
         else if constexpr (LMUL == M4) return __riscv_vlse32_v_f32m4(base, stride, vl);
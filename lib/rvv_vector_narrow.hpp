@@ -66,6 +66,18 @@ vuint32m2_t __riscv_vnsrl_wv_u32m2 (vuint64m4_t op1, vuint32m2_t shift, size_t v
 vuint32m2_t __riscv_vnsrl_wx_u32m2 (vuint64m4_t op1, size_t shift, size_t vl);
 vuint32m4_t __riscv_vnsrl_wv_u32m4 (vuint64m8_t op1, vuint32m4_t shift, size_t vl);
 vuint32m4_t __riscv_vnsrl_wx_u32m4 (vuint64m8_t op1, size_t shift, size_t vl);
+
+vint8mf2_t __riscv_vnclip_wx_i8mf2 (vint16m1_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint8m1_t __riscv_vnclip_wx_i8m1 (vint16m2_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint8m2_t __riscv_vnclip_wx_i8m2 (vint16m4_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint8m4_t __riscv_vnclip_wx_i8m4 (vint16m8_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint16mf2_t __riscv_vnclip_wx_i16mf2 (vint32m1_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint16m1_t __riscv_vnclip_wx_i16m1 (vint32m2_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint16m2_t __riscv_vnclip_wx_i16m2 (vint32m4_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint16m4_t __riscv_vnclip_wx_i16m4 (vint32m8_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint32m1_t __riscv_vnclip_wx_i32m1 (vint64m2_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint32m2_t __riscv_vnclip_wx_i32m2 (vint64m4_t op1, size_t shift, unsigned int vxrm, size_t vl);
+vint32m4_t __riscv_vnclip_wx_i32m4 (vint64m8_t op1, size_t shift, unsigned int vxrm, size_t vl);
 */
 
 // Vector-Vector Narrowing Shift Right Arithmetic for signed integers
@@ -190,4 +202,27 @@ auto VECTOR_NARROW_SRL(const WideVecType& op1, const ShiftType& shift, size_t vl
 	}
 }
 
+// Narrowing fixed-point clip for signed integers: op1 is shifted right by `shift` with
+// round-to-nearest-up (vxrm = RNU) and saturated to the range of T
+template<typename T, int LMUL, typename WideVecType>
+inline auto VECTOR_NCLIP(const WideVecType& op1, size_t shift, size_t vl) {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vnclip_wx_i8mf2(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M1) return __riscv_vnclip_wx_i8m1(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M2) return __riscv_vnclip_wx_i8m2(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M4) return __riscv_vnclip_wx_i8m4(op1, shift, __RISCV_VXRM_RNU, vl);
+    }
+    else if constexpr (std::is_same_v<T, int16_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vnclip_wx_i16mf2(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M1) return __riscv_vnclip_wx_i16m1(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M2) return __riscv_vnclip_wx_i16m2(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M4) return __riscv_vnclip_wx_i16m4(op1, shift, __RISCV_VXRM_RNU, vl);
+    }
+    else if constexpr (std::is_same_v<T, int32_t>) {
+        if constexpr (LMUL == M1) return __riscv_vnclip_wx_i32m1(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M2) return __riscv_vnclip_wx_i32m2(op1, shift, __RISCV_VXRM_RNU, vl);
+        else if constexpr (LMUL == M4) return __riscv_vnclip_wx_i32m4(op1, shift, __RISCV_VXRM_RNU, vl);
+    }
+}
+
 #endif // RVV_VECTOR_NARROW
\ No newline at end of file
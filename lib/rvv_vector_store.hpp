@@ -132,7 +132,15 @@ inline void VECTOR_STORE(T* base, VecType value, size_t vl) {
 
 template<typename T, int LMUL, typename VecType>
 inline void VECTOR_STRIDED_STORE(T* base, ptrdiff_t stride, VecType value, size_t vl) {
-	if constexpr (std::is_same_v<T, float>) {
+	if constexpr (std::is_same_v<T, _Float16>) {
+		if constexpr (LMUL == MF4) __riscv_vsse16_v_f16mf4(base, stride, value, vl);
+		else if constexpr (LMUL == MF2) __riscv_vsse16_v_f16mf2(base, stride, value, vl);
+		else if constexpr (LMUL == M1) __riscv_vsse16_v_f16m1(base, stride, value, vl);
+		else if constexpr (LMUL == M2) __riscv_vsse16_v_f16m2(base, stride, value, vl);
+		else if constexpr (LMUL == M4) __riscv_vsse16_v_f16m4(base, stride, value, vl);
+		else if constexpr (LMUL == M8) __riscv_vsse16_v_f16m8(base, stride, value, vl);
+	}
+	else if constexpr (std::is_same_v<T, float>) {
 		if constexpr (LMUL == M1) __riscv_vsse32_v_f32m1(base, stride, value, vl);
 		else if constexpr (LMUL == M2) __riscv_vsse32_v_f32m2(base, stride, value, vl);
 		else if constexpr (LMUL == M4) __riscv_vsse32_v_f32m4(base, stride, value, vl);
@@ -0,0 +1,52 @@
+#ifndef RVV_VECTOR_WIDEN
+#define RVV_VECTOR_WIDEN
+
+#include <cstddef>
+#include <riscv_vector.h>
+#include <type_traits>
+
+/*
+vint16mf4_t __riscv_vsext_vf2_i16mf4 (vint8mf8_t op1, size_t vl);
+vint16mf2_t __riscv_vsext_vf2_i16mf2 (vint8mf4_t op1, size_t vl);
+vint16m1_t __riscv_vsext_vf2_i16m1 (vint8mf2_t op1, size_t vl);
+vint16m2_t __riscv_vsext_vf2_i16m2 (vint8m1_t op1, size_t vl);
+vint16m4_t __riscv_vsext_vf2_i16m4 (vint8m2_t op1, size_t vl);
+vint16m8_t __riscv_vsext_vf2_i16m8 (vint8m4_t op1, size_t vl);
+vint32mf2_t __riscv_vsext_vf2_i32mf2 (vint16mf4_t op1, size_t vl);
+vint32m1_t __riscv_vsext_vf2_i32m1 (vint16mf2_t op1, size_t vl);
+vint32m2_t __riscv_vsext_vf2_i32m2 (vint16m1_t op1, size_t vl);
+vint32m4_t __riscv_vsext_vf2_i32m4 (vint16m2_t op1, size_t vl);
+vint32m8_t __riscv_vsext_vf2_i32m8 (vint16m4_t op1, size_t vl);
+vint64m1_t __riscv_vsext_vf2_i64m1 (vint32mf2_t op1, size_t vl);
+vint64m2_t __riscv_vsext_vf2_i64m2 (vint32m1_t op1, size_t vl);
+vint64m4_t __riscv_vsext_vf2_i64m4 (vint32m2_t op1, size_t vl);
+vint64m8_t __riscv_vsext_vf2_i64m8 (vint32m4_t op1, size_t vl);
+*/
+
+// Sign-extend to twice the element width (and twice the LMUL); T / LMUL name the source
+template<typename T, int LMUL, typename VecType>
+inline auto VECTOR_SEXT_VF2(const VecType& op1, size_t vl) {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        if constexpr (LMUL == MF8) return __riscv_vsext_vf2_i16mf4(op1, vl);
+        else if constexpr (LMUL == MF4) return __riscv_vsext_vf2_i16mf2(op1, vl);
+        else if constexpr (LMUL == MF2) return __riscv_vsext_vf2_i16m1(op1, vl);
+        else if constexpr (LMUL == M1) return __riscv_vsext_vf2_i16m2(op1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vsext_vf2_i16m4(op1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vsext_vf2_i16m8(op1, vl);
+    }
+    else if constexpr (std::is_same_v<T, int16_t>) {
+        if constexpr (LMUL == MF4) return __riscv_vsext_vf2_i32mf2(op1, vl);
+        else if constexpr (LMUL == MF2) return __riscv_vsext_vf2_i32m1(op1, vl);
+        else if constexpr (LMUL == M1) return __riscv_vsext_vf2_i32m2(op1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vsext_vf2_i32m4(op1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vsext_vf2_i32m8(op1, vl);
+    }
+    else if constexpr (std::is_same_v<T, int32_t>) {
+        if constexpr (LMUL == MF2) return __riscv_vsext_vf2_i64m1(op1, vl);
+        else if constexpr (LMUL == M1) return __riscv_vsext_vf2_i64m2(op1, vl);
+        else if constexpr (LMUL == M2) return __riscv_vsext_vf2_i64m4(op1, vl);
+        else if constexpr (LMUL == M4) return __riscv_vsext_vf2_i64m8(op1, vl);
+    }
+}
+
+#endif // RVV_VECTOR_WIDEN
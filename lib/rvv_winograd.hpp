@@ -0,0 +1,251 @@
+#ifndef RVV_WINOGRAD_HPP
+#define RVV_WINOGRAD_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <riscv_vector.h>
+#include <type_traits>
+#include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_conv_gemm.hpp"
+
+/*
+Winograd convolution F(m x m, 3 x 3), m = 2 or 4, for 3x3 stride-1 layers (single image,
+NCHW, float). With a = m + 2 the output is computed in m x m tiles from a x a input tiles:
+
+    U = G g G^T          filter transform, a x a per (out, in) channel pair
+    V = B^T d B          input transform, a x a per (in channel, tile)
+    M = U . V            summed over input channels: a^2 independent GEMMs
+    Y = A^T M A          output transform, m x m per (out channel, tile)
+
+The multiplications per output drop from 9 to a^2 / m^2 (4 for F(2x2), 2.25 for F(4x4)),
+at the price of the transforms and of some accuracy: F(4x4) has larger transform
+constants and loses roughly one more decimal digit than F(2x2).
+
+The filter transform depends only on the weights and is built once (WinogradFilter). The
+element-wise stage is a batch of a^2 GEMMs  M_xi[OC x T] = U_xi[OC x IC] * V_xi[IC x T]
+run by gemm_strided_batched on the packed GEMM engine. The input and output transforms
+are vectorized across tiles: lane t holds tile t of a tile row, so the a x a tile
+elements are gathered with stride m (padding becomes zero lanes, as in the implicit GEMM
+packer) and every transform row is a handful of vector FMAs with constant scalars.
+
+Tiles are processed in blocks sized so that V and M of one block stay within
+WINOGRAD_WORKSPACE floats, instead of holding a^2 * (IC + OC) * tiles for the full image.
+*/
+
+// Floats of V + M scratch per tile block
+#ifndef WINOGRAD_WORKSPACE
+#define WINOGRAD_WORKSPACE (1 << 20)
+#endif
+
+// Transformed filters: U[xi][oc][ic], xi = 0 .. a^2 - 1
+struct WinogradFilter {
+    size_t m = 0;
+    size_t in_channels = 0;
+    size_t out_channels = 0;
+    std::vector<float> U;
+};
+
+// Transform matrices of F(m x m, 3 x 3), row-major
+struct WinogradMatrices {
+    size_t m, a;
+    const float* BT;    // a x a
+    const float* G;     // a x 3
+    const float* AT;    // m x a
+};
+
+inline WinogradMatrices winograd_matrices(size_t m) {
+    static const float BT2[16] = {
+        1,  0, -1,  0,
+        0,  1,  1,  0,
+        0, -1,  1,  0,
+        0,  1,  0, -1,
+    };
+    static const float G2[12] = {
+        1.0f,  0.0f, 0.0f,
+        0.5f,  0.5f, 0.5f,
+        0.5f, -0.5f, 0.5f,
+        0.0f,  0.0f, 1.0f,
+    };
+    static const float AT2[8] = {
+        1, 1,  1,  0,
+        0, 1, -1, -1,
+    };
+
+    static const float BT4[36] = {
+        4,  0, -5,  0, 1, 0,
+        0, -4, -4,  1, 1, 0,
+        0,  4, -4, -1, 1, 0,
+        0, -2, -1,  2, 1, 0,
+        0,  2, -1, -2, 1, 0,
+        0,  4,  0, -5, 0, 1,
+    };
+    static const float G4[18] = {
+         1.0f / 4,         0.0f,        0.0f,
+        -1.0f / 6,  -1.0f / 6,  -1.0f / 6,
+        -1.0f / 6,   1.0f / 6,  -1.0f / 6,
+         1.0f / 24,  1.0f / 12,  1.0f / 6,
+         1.0f / 24, -1.0f / 12,  1.0f / 6,
+         0.0f,       0.0f,       1.0f,
+    };
+    static const float AT4[24] = {
+        1, 1,  1, 1,  1, 0,
+        0, 1, -1, 2, -2, 0,
+        0, 1,  1, 4,  4, 0,
+        0, 1, -1, 8, -8, 1,
+    };
+
+    if (m == 2) return {2, 4, BT2, G2, AT2};
+    return {4, 6, BT4, G4, AT4};
+}
+
+// dst row r = sum_k mat[r][k] * src row k, for rows of vl lanes (zero coefficients skipped)
+template<int LMUL>
+inline void winograd_apply(const float* mat, size_t rows, size_t cols,
+                           const float* src, ptrdiff_t src_rs, float* dst, ptrdiff_t dst_rs, size_t vl) {
+    for (size_t r = 0; r < rows; r++) {
+        auto v_acc = VECTOR_MOVE<float, LMUL>(0.0f, vl);
+        for (size_t k = 0; k < cols; k++) {
+            float coef = mat[r * cols + k];
+            if (coef == 0.0f) continue;
+            v_acc = VECTOR_FMACC_VF<float, LMUL>(v_acc, coef, VECTOR_LOAD<float, LMUL>(src + k * src_rs, vl), vl);
+        }
+        VECTOR_STORE<float, LMUL>(dst + r * dst_rs, v_acc, vl);
+    }
+}
+
+// U = G g G^T for every (oc, ic) pair, vectorized over pairs. weights are [OC][IC][3][3].
+template<int LMUL>
+inline void winograd_transform_filter(size_t m, const float* weights,
+                                      size_t out_channels, size_t in_channels, WinogradFilter& f) {
+    const WinogradMatrices wm = winograd_matrices(m);
+    const size_t a = wm.a;
+    const size_t pairs = out_channels * in_channels;
+    const size_t VL = SET_VECTOR_LENGTH_MAX<float, LMUL>();
+
+    f.m = wm.m;
+    f.in_channels = in_channels;
+    f.out_channels = out_channels;
+    f.U.resize(a * a * pairs);
+
+    std::vector<float> g(9 * VL), t(a * 3 * VL);
+
+    for (size_t q = 0, vl; q < pairs; q += vl) {
+        vl = SET_VECTOR_LENGTH<float, LMUL>(pairs - q);
+
+        // g[i][j] of vl consecutive pairs (9 floats apart)
+        for (size_t e = 0; e < 9; e++) {
+            auto v_g = VECTOR_STRIDED_LOAD<float, LMUL>(weights + q * 9 + e, 9 * sizeof(float), vl);
+            VECTOR_STORE<float, LMUL>(g.data() + e * VL, v_g, vl);
+        }
+        // t = G g (a x 3), then U = t G^T (a x a) straight into U[xi][pair]
+        for (size_t j = 0; j < 3; j++) {
+            winograd_apply<LMUL>(wm.G, a, 3, g.data() + j * VL, 3 * VL, t.data() + j * VL, 3 * VL, vl);
+        }
+        for (size_t r = 0; r < a; r++) {
+            winograd_apply<LMUL>(wm.G, a, 3, t.data() + r * 3 * VL, VL,
+                                 f.U.data() + (r * a) * pairs + q, pairs, vl);
+        }
+    }
+}
+
+// out = conv3x3(input, stride 1) with filters transformed by winograd_transform_filter.
+// The EP epilogue (bias, scale / shift, activation; not residual) is applied per output
+// channel after the output transform.
+template<int LMUL, unsigned EP = GEMM_EP_NONE>
+inline void conv2d_winograd(const float* input, const WinogradFilter& f, float* output,
+                            size_t in_h, size_t in_w, size_t pad_h, size_t pad_w,
+                            const GemmEpilogue<float>* ep = nullptr) {
+    static_assert((EP & GEMM_EP_RESIDUAL) == 0, "the Winograd output transform has no residual input");
+
+    const WinogradMatrices wm = winograd_matrices(f.m);
+    const size_t m = wm.m, a = wm.a, aa = a * a;
+    const size_t C = f.in_channels, M = f.out_channels;
+    const size_t VL = SET_VECTOR_LENGTH_MAX<float, LMUL>();
+
+    if (in_h + 2 * pad_h < 3 || in_w + 2 * pad_w < 3) return;
+    const size_t out_h = in_h + 2 * pad_h - 2;
+    const size_t out_w = in_w + 2 * pad_w - 2;
+    const size_t tiles_h = (out_h + m - 1) / m;
+    const size_t tiles_w = (out_w + m - 1) / m;
+    const size_t tiles = tiles_h * tiles_w;
+
+    // Tile d[i][j] of tile tw reads input column tw * m - pad_w + j: a stride-m gather
+    ConvGemmShape gs = {C, in_h, in_w, 3, 3, 1, m, pad_h, pad_w};
+
+    const size_t tb_max = std::min(tiles, std::max((size_t)WINOGRAD_WORKSPACE / (aa * (C + M)), (size_t)1));
+    std::vector<float> V(aa * C * tb_max), Mb(aa * M * tb_max);
+    std::vector<float> d(aa * VL), t(aa * VL), y(m * m * VL);
+
+    for (size_t t0 = 0; t0 < tiles; t0 += tb_max) {
+        const size_t tb = std::min(tb_max, tiles - t0);
+
+        // --- Input transform: V[xi][c][tile] = (B^T d B)[xi] ---
+        for (size_t c = 0; c < C; c++) {
+            const float* im_c = input + c * in_h * in_w;
+
+            for (size_t ti = t0, vl; ti < t0 + tb; ti += vl) {
+                const size_t th = ti / tiles_w, tw = ti % tiles_w;
+                vl = std::min({VL, t0 + tb - ti, tiles_w - tw});
+
+                for (size_t i = 0; i < a; i++) {
+                    ptrdiff_t ih = (ptrdiff_t)(th * m + i) - (ptrdiff_t)pad_h;
+                    for (size_t j = 0; j < a; j++) {
+                        ptrdiff_t iw0 = (ptrdiff_t)(tw * m + j) - (ptrdiff_t)pad_w;
+                        conv_gather_row<float, LMUL>(im_c, gs, ih, iw0, vl, d.data() + (i * a + j) * VL);
+                    }
+                }
+                for (size_t j = 0; j < a; j++) {
+                    winograd_apply<LMUL>(wm.BT, a, a, d.data() + j * VL, a * VL, t.data() + j * VL, a * VL, vl);
+                }
+                for (size_t r = 0; r < a; r++) {
+                    winograd_apply<LMUL>(wm.BT, a, a, t.data() + r * a * VL, VL,
+                                         V.data() + (r * a) * C * tb + c * tb + (ti - t0), C * tb, vl);
+                }
+            }
+        }
+
+        // --- Element-wise stage: a^2 GEMMs M_xi[M x tb] = U_xi[M x C] * V_xi[C x tb] ---
+        gemm_strided_batched<float, LMUL>(aa, M, tb, C,
+                                          f.U.data(), C, 1, M * C,
+                                          V.data(), tb, 1, C * tb,
+                                          Mb.data(), tb, M * tb);
+
+        // --- Output transform: Y = A^T M A, cropped to the output ---
+        for (size_t oc = 0; oc < M; oc++) {
+            float* out_c = output + oc * out_h * out_w;
+
+            for (size_t ti = t0, vl; ti < t0 + tb; ti += vl) {
+                const size_t th = ti / tiles_w, tw = ti % tiles_w;
+                vl = std::min({VL, t0 + tb - ti, tiles_w - tw});
+
+                const float* m_src = Mb.data() + oc * tb + (ti - t0);
+                for (size_t j = 0; j < a; j++) {
+                    winograd_apply<LMUL>(wm.AT, m, a, m_src + j * M * tb, a * M * tb, t.data() + j * VL, a * VL, vl);
+                }
+                for (size_t r = 0; r < m; r++) {
+                    winograd_apply<LMUL>(wm.AT, m, a, t.data() + r * a * VL, VL, y.data() + r * m * VL, VL, vl);
+                }
+
+                for (size_t r = 0; r < m && th * m + r < out_h; r++) {
+                    for (size_t cc = 0; cc < m; cc++) {
+                        // Lanes whose column tw * m + cc falls inside the output
+                        size_t col0 = tw * m + cc;
+                        if (col0 >= out_w) break;
+                        size_t n = std::min(vl, (out_w - col0 + m - 1) / m);
+
+                        auto v_y = VECTOR_LOAD<float, LMUL>(y.data() + (r * m + cc) * VL, n);
+                        if constexpr (EP != GEMM_EP_NONE) {
+                            v_y = gemm_epilogue_apply<float, LMUL, EP>(v_y, *ep, oc, 0, n);
+                        }
+                        VECTOR_STRIDED_STORE<float, LMUL>(out_c + (th * m + r) * out_w + col0,
+                                                          m * sizeof(float), v_y, n);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // RVV_WINOGRAD_HPP
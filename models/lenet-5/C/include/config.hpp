@@ -7,7 +7,8 @@
 #define maxpool     maxpool_e32m8
 #define relu        relu_e32m8
 #define bias_add    bias_add_e32m8
-#define dense       dense_e32m8
+#define dense       dense_batched
+#define dense_packed dense_prepacked
 #define tensor_add  tensor_add_e32m8
 #define softmax		softmax
 
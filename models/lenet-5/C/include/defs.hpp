@@ -100,5 +100,15 @@ void relu_e32m8(float* input, float* output, size_t size);
 
 void dense_e32m8(const float* input, const float* weights, const float* bias,
 	float* output, size_t in_features, size_t out_features);
+
+void dense_batched(const float* input, const float* weights, const float* bias,
+	float* output, size_t batch, size_t in_features, size_t out_features);
+
+// Opaque [OUT x IN] weights in GEMM panel layout, packed once and reused by dense_prepacked
+struct PackedWeights;
+PackedWeights* pack_weights(const float* weights, size_t in_features, size_t out_features);
+void free_packed_weights(PackedWeights* w);
+void dense_prepacked(const float* input, const PackedWeights* w, const float* bias, float* output,
+	size_t batch);
 	
 #endif // DEFS_HPP
\ No newline at end of file
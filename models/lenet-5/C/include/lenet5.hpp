@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include "defs.hpp"
 
 class LeNet5 {
@@ -15,6 +16,9 @@ private:
     std::vector<float> f4_w, f4_b;
     std::vector<float> f5_w, f5_b;
 
+    // Dense weights packed at load, only when BATCH_SIZE > 1 (a single image runs the GEMV)
+    std::shared_ptr<PackedWeights> f4_packed, f5_packed;
+
     // --- Intermediate Tensors (Activations) ---
     std::vector<float> input_tensor;
     std::vector<float> c1_out_nobias, c1_out, relu1_out, pool1_out;
@@ -13,6 +13,10 @@
 #include <cstring>   // For std::memset
 #include <cfloat>    // For FLT_MAX
 #include "rvv_defs.hpp"
+#include "rvv_gemm.hpp"
+#include "rvv_gemv.hpp"
+#include "rvv_conv_gemm.hpp"
+#include "rvv_dense.hpp"
 
 #include "../include/defs.hpp"
 
@@ -48,189 +52,6 @@ void load_preprocessed_image(std::vector<float>& img_buffer, const std::string&
 // KERNELS
 // =======================================================
 
-#define MIN(a,b) (((a)<(b))?(a):(b))
-
-void im2col_e32m8(
-    const float* data_im,
-    float* data_col,
-    int channels,
-    int height,
-    int width,
-    int kernel_h,
-    int kernel_w,
-    int pad_h,
-    int pad_w,
-    int stride_h,
-    int stride_w)
-{
-    const int out_height =
-        (height + 2 * pad_h - kernel_h) / stride_h + 1;
-    const int out_width =
-        (width + 2 * pad_w - kernel_w) / stride_w + 1;
-    const int out_area = out_height * out_width;
-
-    for (int c = 0; c < channels; ++c) {
-        const float* im_c = data_im + c * height * width;
-
-        for (int kh = 0; kh < kernel_h; ++kh) {
-            for (int kw = 0; kw < kernel_w; ++kw) {
-
-                const int col_row =
-                    (c * kernel_h * kernel_w) + (kh * kernel_w + kw);
-                float* col_ptr = data_col + col_row * out_area;
-
-                for (int oh = 0; oh < out_height; ++oh) {
-                    const int ih = oh * stride_h - pad_h + kh;
-                    float* dst = col_ptr + oh * out_width;
-
-                    // If height is out of bounds → whole row is zero
-                    if (ih < 0 || ih >= height) {
-                        int ow = 0;
-                        while (ow < out_width) {
-                            size_t vl =
-                                SET_VECTOR_LENGTH<float, M8>(out_width - ow);
-                            vfloat32m8_t vz =
-                                VECTOR_BROADCAST<float, M8>(0.0f, vl);
-                            VECTOR_STORE<float, M8>(dst + ow, vz, vl);
-                            ow += vl;
-                        }
-                        continue;
-                    }
-
-                    // Height valid → check width per element
-                    const float* im_row = im_c + ih * width;
-
-                    int ow = 0;
-                    while (ow < out_width) {
-                        size_t vl =
-                            SET_VECTOR_LENGTH<float, M8>(out_width - ow);
-
-                        int iw0 = ow * stride_w - pad_w + kw;
-
-                        // ---------- FAST PATH ----------
-                        if (stride_w == 1 &&
-                            iw0 >= 0 &&
-                            iw0 + (int)vl <= width) {
-
-                            const float* src = im_row + iw0;
-                            vfloat32m8_t v =
-                                VECTOR_LOAD<float, M8>(src, vl);
-                            VECTOR_STORE<float, M8>(dst + ow, v, vl);
-                        }
-                        // ---------- SAFE PATH ----------
-                        else {
-                            float tmp[256]; // enough for any RVV VL
-
-                            for (size_t i = 0; i < vl; ++i) {
-                                int iw = iw0 + (int)i * stride_w;
-                                if (iw >= 0 && iw < width) {
-                                    tmp[i] = im_row[iw];
-                                } else {
-                                    tmp[i] = 0.0f;
-                                }
-                            }
-
-                            vfloat32m8_t v =
-                                VECTOR_LOAD<float, M8>(tmp, vl);
-                            VECTOR_STORE<float, M8>(dst + ow, v, vl);
-                        }
-
-                        ow += vl;
-                    }
-                }
-            }
-        }
-    }
-}
-
-void gemm_blocked_e32m8(const float* A, const float* B, float* C,
-                        int M, int N, int K,
-                        int BM, int BN, int BK) {
-    std::memset(C, 0, M * N * sizeof(float));
-    for (int i0 = 0; i0 < M; i0 += BM) {
-        int i_max = MIN(M, i0 + BM);
-        for (int k0 = 0; k0 < K; k0 += BK) {
-            int k_max = MIN(K, k0 + BK);
-            for (int j0 = 0; j0 < N; j0 += BN) {
-                int j_max = MIN(N, j0 + BN);
-                for (int i = i0; i < i_max; ++i) {
-                    float* c_row_ptr = &C[i * N + j0];
-                    size_t j = 0;
-                    size_t current_bn = j_max - j0;
-                    while (j < current_bn) {
-                        size_t vl = SET_VECTOR_LENGTH<float, M8>(current_bn - j);
-                        vfloat32m8_t v_acc = VECTOR_LOAD<float, M8>(&c_row_ptr[j], vl);
-                        for (int k = k0; k < k_max; ++k) {
-                            float a_val = A[i * K + k];
-                            const float* b_row_ptr = &B[k * N + j0 + j];
-                            vfloat32m8_t v_b = VECTOR_LOAD<float, M8>(b_row_ptr, vl);
-                            v_acc = VECTOR_FMACC_VF<float, M8>(v_acc, a_val, v_b, vl);
-                        }
-                        VECTOR_STORE<float, M8>(&c_row_ptr[j], v_acc, vl);
-                        j += vl;
-                    }
-                }
-            }
-        }
-    }
-}
-
-void conv2d_im2col_gemm_m8(
-    const float* input, const float* kernel, const float* bias,
-    float* output,
-    float* col_buf, float* gemm_buf,
-    int in_channels, int input_h, int input_w, 
-    int out_channels, int kernel_h, int kernel_w,
-    int pad_h, int pad_w, int stride_h, int stride_w,
-    int has_bias) {
-
-    // 1. Setup Dimensions
-    int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
-    int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
-    
-    // GEMM Dimensions
-    int M = out_channels;
-    int K = in_channels * kernel_h * kernel_w;
-    int N = out_h * out_w;
-    
-    // 2. Vectorized Im2Col (M8)
-    // We use the external col_buf provided by main()
-    im2col_e32m8(input, col_buf,
-                 in_channels, input_h, input_w, 
-                 kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w);
-
-    // 3. Blocked GEMM (M8)
-    // Results go into gemm_buf first (to handle scaling/bias later) or directly to output
-    // Since we need to add bias, let's write to gemm_buf first.
-    // Note: Tuning the block sizes (BM=4, BN=16, BK=32) is key for performance.
-    // You can try (32, 32, 32) or (8, 64, 16) depending on the exact Ara config.
-    gemm_blocked_e32m8(kernel, col_buf, gemm_buf, M, N, K, 8, 64, 32); 
-
-    // 4. Vectorized Bias Add (M8) & Store to Output
-    // If has_bias is 0, this essentially just copies gemm_buf to output
-    for (int m = 0; m < M; ++m) {
-        float b_val = has_bias ? bias[m] : 0.0f;
-        
-        float* src_ptr = &gemm_buf[m * N];
-        float* dst_ptr = &output[m * N];
-        
-        size_t n = 0;
-        while (n < N) {
-            size_t vl = SET_VECTOR_LENGTH<float, M8>(N - n);
-            
-            vfloat32m8_t v_data = VECTOR_LOAD<float, M8>(&src_ptr[n], vl);
-            
-            // Only add bias if it exists, otherwise just move data
-            if (has_bias) {
-                v_data = VECTOR_ADD<float, M8>(v_data, b_val, vl);
-            }
-            
-            VECTOR_STORE<float, M8>(&dst_ptr[n], v_data, vl);
-            n += vl;
-        }
-    }
-}
-
 void conv2d(
     const float* input, float* output, const float* weights,
     int batch,
@@ -243,27 +64,17 @@ void conv2d(
     int out_h = (in_height + 2 * pad_h - kernel_h) / stride_h + 1;
     int out_w = (in_width  + 2 * pad_w - kernel_w) / stride_w + 1;
 
-    int K = in_channels * kernel_h * kernel_w;
-    int N = out_h * out_w;
-
-    float* col_buf  = new float[K * N];
-    float* gemm_buf = new float[out_channels * N];
+    // Implicit GEMM per image: im2col is gathered into the GEMM panels, no col buffer
+    ConvGemmShape s = {(size_t)in_channels, (size_t)in_height, (size_t)in_width,
+                       (size_t)kernel_h, (size_t)kernel_w,
+                       (size_t)stride_h, (size_t)stride_w, (size_t)pad_h, (size_t)pad_w};
 
     for (int n = 0; n < batch; ++n) {
         const float* in_ptr  = input  + n * in_channels * in_height * in_width;
         float* out_ptr = output + n * out_channels * out_h * out_w;
 
-        conv2d_im2col_gemm_m8(
-            in_ptr, weights, nullptr, out_ptr,
-            col_buf, gemm_buf,
-            in_channels, in_height, in_width,
-            out_channels, kernel_h, kernel_w,
-            pad_h, pad_w, stride_h, stride_w,
-            0);
+        conv2d_implicit_gemm<float, M8>(in_ptr, weights, out_ptr, s, out_channels);
     }
-
-    delete[] col_buf;
-    delete[] gemm_buf;
 }
 
 void tensor_add_e32m8(const float* input_a, const float* input_b, float* output,
@@ -372,29 +183,40 @@ void relu_e32m8(float* input, float* output, size_t size) {
 
 void dense_e32m8(const float* input, const float* weights, const float* bias,
 	float* output, size_t in_features, size_t out_features) {
-	 
-	 size_t K = in_features;
-	 size_t N = out_features;
- 
-	 // We iterate through outputs (j)
-	 for (size_t j_idx = 0; j_idx < N; ) {
-		 size_t vl = SET_VECTOR_LENGTH<float, M8>(N - j_idx);
- 
-		 // 1. Initialize with bias
-		 auto v_acc = VECTOR_LOAD<float, M8>(&bias[j_idx], vl);
- 
-		 for (size_t k = 0; k < K; k++) {
-			 
-			 // This requires a STRIDED LOAD
-			 auto v_w = VECTOR_STRIDED_LOAD<float, M8>(&weights[j_idx * K + k], K * sizeof(float), vl);
-			 auto v_in = VECTOR_MOVE<float, M8>(input[k], vl);
-			 v_acc = VECTOR_FMACC<float, M8>(v_acc, v_in, v_w, vl);
-		 }
- 
-		 VECTOR_STORE<float, M8>(&output[j_idx], v_acc, vl);
-		 j_idx += vl;
-	 }
- }
+
+	size_t K = in_features;
+	size_t N = out_features;
+
+	// output = bias + weights * input, weights are [OUT x IN]: batch 1 is a GEMV
+	std::memcpy(output, bias, N * sizeof(float));
+	gemv_n<float, M8>(N, K, weights, K, input, output, true);
+}
+
+// [batch x IN] -> [batch x OUT]: GEMV per sample or one GEMM for the batch (lib/rvv_dense.hpp)
+void dense_batched(const float* input, const float* weights, const float* bias,
+	float* output, size_t batch, size_t in_features, size_t out_features) {
+	dense_batched<M8>(input, weights, bias, output, batch, in_features, out_features);
+}
+
+// [OUT x IN] weights in GEMM panel layout, packed once at model load for batched inference
+struct PackedWeights {
+	GemmPackedB<float, M8> b;
+};
+
+PackedWeights* pack_weights(const float* weights, size_t in_features, size_t out_features) {
+	PackedWeights* w = new PackedWeights;
+	dense_prepack<M8>(weights, in_features, out_features, w->b);
+	return w;
+}
+
+void free_packed_weights(PackedWeights* w) {
+	delete w;
+}
+
+void dense_prepacked(const float* input, const PackedWeights* w, const float* bias, float* output,
+	size_t batch) {
+	dense_prepacked<M8>(input, w->b, bias, output, batch);
+}
 
 void maxpool_e32m8(const float* input, float* output,
                            int batch, int channels,
@@ -7,6 +7,16 @@
 
 #include "../include/config.hpp"
 
+// Dense layer over the whole batch: on the load-time packed weights when there are any
+static void dense_layer(const float* input, const std::vector<float>& weights, const PackedWeights* packed,
+                        const std::vector<float>& bias, float* output, size_t in_features, size_t out_features) {
+    if (packed) {
+        dense_packed(input, packed, bias.data(), output, BATCH_SIZE);
+    } else {
+        dense(input, weights.data(), bias.data(), output, BATCH_SIZE, in_features, out_features);
+    }
+}
+
 // --- Constructor Implementation ---
 LeNet5::LeNet5(const std::string& model_path) {
     std::cout << "Loading weights..." << std::endl;
@@ -24,6 +34,13 @@ LeNet5::LeNet5(const std::string& model_path) {
     f5_b = load_weights(model_path + "/f5.f5.f5.bias.bin");
     std::cout << "All 12 weights/biases loaded." << std::endl;
 
+    // Batched inference multiplies the dense layers on panels packed here, once, instead of
+    // packing the weights on every call; a single image runs the GEMV, which packs nothing
+    if (BATCH_SIZE > 1) {
+        f4_packed.reset(pack_weights(f4_w.data(), F4_IN, F4_OUT), free_packed_weights);
+        f5_packed.reset(pack_weights(f5_w.data(), F5_IN, F5_OUT), free_packed_weights);
+    }
+
     // --- Allocate Memory for Tensors ---
     input_tensor.resize(IN_SIZE);
     
@@ -118,10 +135,10 @@ int LeNet5::predict(const std::vector<float>& image_data) {
     
     relu(c3_out.data(), relu3_out.data(), C3_OUT_SIZE);
 
-    dense(relu3_out.data(), f4_w.data(), f4_b.data(), f4_out.data(), F4_IN, F4_OUT);
+    dense_layer(relu3_out.data(), f4_w, f4_packed.get(), f4_b, f4_out.data(), F4_IN, F4_OUT);
     relu(f4_out.data(), relu4_out.data(), f4_out.size());
     
-    dense(relu4_out.data(), f5_w.data(), f5_b.data(), f5_out.data(), F5_IN, F5_OUT);
+    dense_layer(relu4_out.data(), f5_w, f5_packed.get(), f5_b, f5_out.data(), F5_IN, F5_OUT);
 
     softmax(f5_out.data(), final_output.data(), F5_OUT);
 
@@ -24,44 +24,84 @@ std::vector<SelectedIndex> nms_e32m8(
     int center_point_box
 );
 
-#ifndef MIN
-#define MIN(a,b) ((a) < (b) ? (a) : (b))
-#endif
-
-// Fixed GEMM block sizes (previously configurable)
-#define GEMM_BLOCK_M 8
-#define GEMM_BLOCK_N 64
-#define GEMM_BLOCK_K 32
-
 /****************** Specific Image Pre-processing Kernel ******************/
 void preprocess_image(
     float* data, const float* scale, const float* bias,
     int channels, int height, int width);
 
 /************************************ CONV ************************************/
+// 3x3 layers of the NCHW path can run the register-blocked direct conv (lib/rvv_conv3x3.hpp)
+// instead of the implicit GEMM; opt in with -DYOLO_CONV3X3_DIRECT=1
+#ifndef YOLO_CONV3X3_DIRECT
+#define YOLO_CONV3X3_DIRECT 0
+#endif
+
+// 3x3 stride-1 layers of the NCHW path can run Winograd (lib/rvv_winograd.hpp) from
+// filters transformed once in load_all_weights; opt in with -DYOLO_WINOGRAD=1
+#ifndef YOLO_WINOGRAD
+#define YOLO_WINOGRAD 0
+#endif
+
+// Transformed filters of one layer; tile_m = 2 (F(2x2,3x3)) or 4 (F(4x4,3x3)), anything
+// else throws std::invalid_argument
+struct WinogradConvWeights;
+
+WinogradConvWeights* pack_winograd_weights(const float* weights,
+    int in_channels, int out_channels, int tile_m);
+void free_winograd_weights(WinogradConvWeights* w);
+
 void conv2d(
     const float* input, float* output, const float* weights,
     int in_channels, int in_height, int in_width,
     int out_channels, int out_height, int out_width,
-    int kernel_size, int stride, int pad_top, int pad_left);
-
-void gemm_blocked_e32m8(const float* A, const float* B, float* C,
-                        int M, int N, int K,
-                        int BM, int BN, int BK);
-
-void im2col_e32m8(const float* data_im, float* data_col,
-                  int channels, int height, int width,
-                  int kernel_h, int kernel_w,
-                  int pad_h, int pad_w,
-                  int stride_h, int stride_w);
-
-void conv2d_im2col_gemm_m8(
-    const float* input, const float* kernel, const float* bias,
-    float* output, float* col_buf, float* gemm_buf,
-    int in_channels, int input_h, int input_w, 
-    int out_channels, int kernel_h, int kernel_w,
-    int pad_h, int pad_w, int stride_h, int stride_w,
-    int has_bias);
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bias = nullptr);
+
+void conv2d_bn_leaky(
+    const float* input, float* output, const float* weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bn_scale, const float* bn_bias, const float* bn_mean, const float* bn_var,
+    float epsilon, float alpha,
+    const WinogradConvWeights* winograd = nullptr);
+
+/****************** Blocked NCHW[c] layout ******************/
+// Channels per block of the blocked activations (one m4 register group at VLEN >= 128)
+#ifndef YOLO_NCHWC_BLOCK
+#define YOLO_NCHWC_BLOCK 16
+#endif
+
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width);
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width);
+
+// [OC][IC][K][K] -> [OC / cb][IC][K][K][cb], consumed by the *_nchwc convolutions
+std::vector<float> pack_conv_weights_nchwc(const std::vector<float>& weights,
+    int out_channels, int in_channels, int kernel_size);
+
+// bias (optional) zero-padded to whole channel blocks at load time
+void conv2d_nchwc(
+    const float* input, float* output, const float* packed_weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bias = nullptr);
+
+void conv2d_bn_leaky_nchwc(
+    const float* input, float* output, const float* packed_weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bn_scale, const float* bn_bias, const float* bn_mean, const float* bn_var,
+    float epsilon, float alpha);
+
+void maxpool_nchwc(const float* input, float* output,
+	int channels,
+	int in_h, int in_w,
+	int out_h, int out_w,
+	int k_h, int k_w,
+	int stride_h, int stride_w,
+	int pad_h, int pad_w);
 
 
 /************************************ Bias Add ************************************/
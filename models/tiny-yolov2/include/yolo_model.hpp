@@ -3,6 +3,8 @@
 
 #include "model.hpp" // The one with constants
 
+struct WinogradConvWeights;  // kernels.hpp
+
 // Holds all parameters loaded from .bin files
 struct ModelWeights {
     // Preprocessing
@@ -26,6 +28,9 @@ struct ModelWeights {
     std::vector<float> conv7_w, bn7_s, bn7_b, bn7_m, bn7_v;
     // Layer 8 (Final)
     std::vector<float> conv8_w, conv8_b;
+
+    // Winograd filters of layers 0-7, built only with YOLO_WINOGRAD on the NCHW path
+    std::shared_ptr<WinogradConvWeights> conv_winograd[8];
 };
 
 // Main inference function
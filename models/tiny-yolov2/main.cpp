@@ -1,6 +1,8 @@
 // main.cpp
 #include "yolo_model.hpp"
+#include "../../lib/rvv_gemm.hpp"
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 
@@ -37,12 +39,18 @@ void save_detection_results(const std::vector<BoundingBox>& boxes, const std::st
 
 int main(int argc, char* argv[]) {
     if (argc < 3) {
-        std::cerr << "Usage: " << argv[0] << " <input_bin_file> <weights_directory>" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <input_bin_file> <weights_directory> [num_threads]" << std::endl;
         return -1;
     }
 
     std::string input_bin_path = argv[1];
     std::string weights_dir = argv[2];
+
+    // Conv layers run on the GEMM engine; spread it over num_threads harts
+    if (argc >= 4) {
+        gemm_set_num_threads(atoi(argv[3]));
+    }
+    std::cout << "GEMM threads: " << gemm_get_num_threads() << std::endl;
     
     // 1. Load the pre-processed input tensor
     std::cout << "Loading input tensor from " << input_bin_path << "..." << std::endl;
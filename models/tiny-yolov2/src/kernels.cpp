@@ -5,7 +5,13 @@
 #include <algorithm>  // For std::sort, std::min
 #include <cstring>   // For memcpy
 #include <cmath>     // For mathematical functions
+#include <stdexcept>
 #include "../../../lib/rvv_defs.hpp"
+#include "../../../lib/rvv_gemm.hpp"
+#include "../../../lib/rvv_conv_gemm.hpp"
+#include "../../../lib/rvv_conv3x3.hpp"
+#include "../../../lib/rvv_winograd.hpp"
+#include "../../../lib/rvv_nchwc.hpp"
 
 using namespace std;
 
@@ -40,155 +46,172 @@ void conv2d(
     const float* input, float* output, const float* weights,
     int in_channels, int in_height, int in_width,
     int out_channels, int out_height, int out_width,
-    int kernel_size, int stride, int pad_top, int pad_left){
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bias){
+
+    // Implicit GEMM: im2col is gathered into the GEMM panels, no K x N buffer per call
+    ConvGemmShape s = {(size_t)in_channels, (size_t)in_height, (size_t)in_width,
+                       (size_t)kernel_size, (size_t)kernel_size,
+                       (size_t)stride, (size_t)stride, (size_t)pad_top, (size_t)pad_left};
+
+    GemmEpilogue<float> ep;
+    ep.bias = bias;
+#if YOLO_CONV3X3_DIRECT
+    if (kernel_size == 3) {
+        if (bias) {
+            conv2d_3x3_direct<M4, GEMM_EP_BIAS>(input, weights, output, s, out_channels, &ep);
+        } else {
+            conv2d_3x3_direct<M4>(input, weights, output, s, out_channels);
+        }
+        return;
+    }
+#endif
+    if (bias) {
+        conv2d_implicit_gemm<float, M8, GEMM_EP_BIAS>(input, weights, output, s, out_channels, false, &ep);
+    } else {
+        conv2d_implicit_gemm<float, M8>(input, weights, output, s, out_channels);
+    }
+}
 
-    // Use vector convolution with temporary buffers
-    int out_h = (in_height + 2 * pad_top - kernel_size) / stride + 1;
-    int out_w = (in_width + 2 * pad_left - kernel_size) / stride + 1;
-    int K = in_channels * kernel_size * kernel_size;
-    int N = out_h * out_w;
-    
-    float* col_buf = new float[K * N];
-    float* gemm_buf = new float[out_channels * N];
-    
-    conv2d_im2col_gemm_m8(input, weights, nullptr, output, 
-                          col_buf, gemm_buf,
-                          in_channels, in_height, in_width,
-                          out_channels, kernel_size, kernel_size,
-                          pad_top, pad_left, stride, stride, 0);
-    
-    delete[] col_buf;
-    delete[] gemm_buf;
+struct WinogradConvWeights {
+    WinogradFilter f;
+};
+
+WinogradConvWeights* pack_winograd_weights(const float* weights,
+    int in_channels, int out_channels, int tile_m) {
+    if (tile_m != 2 && tile_m != 4)
+        throw std::invalid_argument("Winograd tile_m must be 2 (F(2x2,3x3)) or 4 (F(4x4,3x3))");
+
+    WinogradConvWeights* w = new WinogradConvWeights;
+    winograd_transform_filter<M8>(tile_m, weights, out_channels, in_channels, w->f);
+    return w;
 }
 
-void gemm_blocked_e32m8(const float* A, const float* B, float* C,
-                        int M, int N, int K,
-                        int BM, int BN, int BK) {
-    memset(C, 0, M * N * sizeof(float));
-    for (int i0 = 0; i0 < M; i0 += BM) {
-        int i_max = MIN(M, i0 + BM);
-        for (int k0 = 0; k0 < K; k0 += BK) {
-            int k_max = MIN(K, k0 + BK);
-            for (int j0 = 0; j0 < N; j0 += BN) {
-                int j_max = MIN(N, j0 + BN);
-                for (int i = i0; i < i_max; ++i) {
-                    float* c_row_ptr = &C[i * N + j0];
-                    size_t j = 0;
-                    size_t current_bn = j_max - j0;
-                    while (j < current_bn) {
-                        size_t vl = SET_VECTOR_LENGTH<float, M8>(current_bn - j);
-                        vfloat32m8_t v_acc = VECTOR_LOAD<float, M8>(&c_row_ptr[j], vl);
-                        for (int k = k0; k < k_max; ++k) {
-                            float a_val = A[i * K + k];
-                            const float* b_row_ptr = &B[k * N + j0 + j];
-                            vfloat32m8_t v_b = VECTOR_LOAD<float, M8>(b_row_ptr, vl);
-                            v_acc = VECTOR_FMACC<float, M8>(v_acc, a_val, v_b, vl);
-                        }
-                        VECTOR_STORE<float, M8>(&c_row_ptr[j], v_acc, vl);
-                        j += vl;
-                    }
-                }
-            }
-        }
+void free_winograd_weights(WinogradConvWeights* w) {
+    delete w;
+}
+
+// Conv -> BatchNorm -> LeakyReLU in one pass: BN is folded into a per-channel
+// scale / shift and applied, with the activation, to the GEMM tiles before they
+// are stored, so the activation map is written once instead of three times.
+// With a Winograd handle (3x3 stride-1 layers only) the same epilogue runs after the
+// Winograd output transform.
+void conv2d_bn_leaky(
+    const float* input, float* output, const float* weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bn_scale, const float* bn_bias, const float* bn_mean, const float* bn_var,
+    float epsilon, float alpha,
+    const WinogradConvWeights* winograd){
+
+    std::vector<float> scale(out_channels), shift(out_channels);
+    for (int c = 0; c < out_channels; ++c) {
+        scale[c] = bn_scale[c] / std::sqrt(bn_var[c] + epsilon);
+        shift[c] = bn_bias[c] - bn_mean[c] * scale[c];
+    }
+
+    ConvGemmShape s = {(size_t)in_channels, (size_t)in_height, (size_t)in_width,
+                       (size_t)kernel_size, (size_t)kernel_size,
+                       (size_t)stride, (size_t)stride, (size_t)pad_top, (size_t)pad_left};
+
+    GemmEpilogue<float> ep;
+    ep.scale = scale.data();
+    ep.shift = shift.data();
+    ep.alpha = alpha;
+    if (winograd) {
+        conv2d_winograd<M8, GEMM_EP_SCALE_SHIFT | GEMM_EP_LEAKY_RELU>(input, winograd->f, output,
+                                                                      in_height, in_width, pad_top, pad_left, &ep);
+        return;
     }
+#if YOLO_CONV3X3_DIRECT
+    if (kernel_size == 3) {
+        conv2d_3x3_direct<M4, GEMM_EP_SCALE_SHIFT | GEMM_EP_LEAKY_RELU>(input, weights, output, s, out_channels, &ep);
+        return;
+    }
+#endif
+    conv2d_implicit_gemm<float, M8, GEMM_EP_SCALE_SHIFT | GEMM_EP_LEAKY_RELU>(input, weights, output, s,
+                                                                              out_channels, false, &ep);
 }
 
-void im2col_e32m8(const float* data_im, float* data_col,
-                  int channels, int height, int width,
-                  int kernel_h, int kernel_w,
-                  int pad_h, int pad_w,
-                  int stride_h, int stride_w) {
-    
-    int out_height = (height + 2 * pad_h - kernel_h) / stride_h + 1;
-    int out_width = (width + 2 * pad_w - kernel_w) / stride_w + 1;
-    int out_area = out_height * out_width;
+/****************** Blocked NCHW[c] layout (YOLO_NCHWC_BLOCK channels per vector) ******************/
+// The network body runs on [C / cb][H][W][cb] tensors (cb = YOLO_NCHWC_BLOCK, one m4
+// register group at VLEN >= 128): conv accumulators hold cb output channels of a pixel and
+// pooling loads cb channels per tap, all unit-stride. Only the input image and the final
+// output are converted.
+void nchw_to_nchwc(const float* src, float* dst, int channels, int height, int width) {
+    nchw_to_nchwc<M8>(src, dst, channels, height, width, YOLO_NCHWC_BLOCK);
+}
 
-    for (int c = 0; c < channels; ++c) {
-        for (int kh = 0; kh < kernel_h; ++kh) {
-            for (int kw = 0; kw < kernel_w; ++kw) {
-                
-                float* col_row_ptr = data_col + (c * kernel_h * kernel_w + kh * kernel_w + kw) * out_area;
-
-                for (int oh = 0; oh < out_height; ++oh) {
-                    
-                    int in_h = oh * stride_h - pad_h + kh;
-                    float* dest_ptr = col_row_ptr + (oh * out_width);
-
-                    if (in_h < 0 || in_h >= height) {
-                        for (int ow = 0; ow < out_width; ) {
-                            size_t vl = SET_VECTOR_LENGTH<float, M8>(out_width - ow);
-                            vfloat32m8_t v_zero = VECTOR_BROADCAST<float, M8>(0.0f, vl);
-                            VECTOR_STORE<float, M8>(dest_ptr + ow, v_zero, vl);
-                            ow += vl;
-                        }
-                    } else {
-                        for (int ow = 0; ow < out_width; ) {
-                            size_t vl = SET_VECTOR_LENGTH<float, M8>(out_width - ow);
-                            int in_w = ow * stride_w - pad_w + kw;
-                            
-                            const float* src_ptr = data_im + (c * height * width) + (in_h * width) + in_w;
-                            
-                            if (stride_w == 1) {
-                                vfloat32m8_t v_data = VECTOR_LOAD<float, M8>(src_ptr, vl);
-                                VECTOR_STORE<float, M8>(dest_ptr + ow, v_data, vl);
-                            } else {
-                                ptrdiff_t s_stride = stride_w * sizeof(float);
-                                vfloat32m8_t v_data = VECTOR_STRIDED_LOAD<float, M8>(src_ptr, s_stride, vl);
-                                VECTOR_STORE<float, M8>(dest_ptr + ow, v_data, vl);
-                            }
+void nchwc_to_nchw(const float* src, float* dst, int channels, int height, int width) {
+    nchwc_to_nchw<M8>(src, dst, channels, height, width, YOLO_NCHWC_BLOCK);
+}
 
-                            ow += vl;
-                        }
-                    }
-                }
-            }
-        }
+std::vector<float> pack_conv_weights_nchwc(const std::vector<float>& weights,
+    int out_channels, int in_channels, int kernel_size) {
+    std::vector<float> packed(nchwc_weights_size(out_channels, in_channels, kernel_size, kernel_size, YOLO_NCHWC_BLOCK));
+    nchwc_pack_weights(weights.data(), packed.data(), out_channels, in_channels, kernel_size, kernel_size, YOLO_NCHWC_BLOCK);
+    return packed;
+}
+
+void conv2d_nchwc(
+    const float* input, float* output, const float* packed_weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bias){
+
+    ConvGemmShape s = {(size_t)in_channels, (size_t)in_height, (size_t)in_width,
+                       (size_t)kernel_size, (size_t)kernel_size,
+                       (size_t)stride, (size_t)stride, (size_t)pad_top, (size_t)pad_left};
+
+    if (bias) {
+        GemmEpilogue<float> ep;
+        ep.bias = bias;
+        conv2d_nchwc<M4, GEMM_EP_BIAS>(input, packed_weights, output, s, out_channels, YOLO_NCHWC_BLOCK, &ep);
+    } else {
+        conv2d_nchwc<M4>(input, packed_weights, output, s, out_channels, YOLO_NCHWC_BLOCK);
     }
 }
 
-void conv2d_im2col_gemm_m8(
-    const float* input, const float* kernel, const float* bias,
-    float* output,
-    float* col_buf, float* gemm_buf,
-    int in_channels, int input_h, int input_w, 
-    int out_channels, int kernel_h, int kernel_w,
-    int pad_h, int pad_w, int stride_h, int stride_w,
-    int has_bias) {
-
-    int out_h = (input_h + 2 * pad_h - kernel_h) / stride_h + 1;
-    int out_w = (input_w + 2 * pad_w - kernel_w) / stride_w + 1;
-    
-    int M = out_channels;
-    int K = in_channels * kernel_h * kernel_w;
-    int N = out_h * out_w;
-    
-    im2col_e32m8(input, col_buf,
-                 in_channels, input_h, input_w, 
-                 kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w);
+// Blocked counterpart of conv2d_bn_leaky: the folded BN scale / shift are loaded as one
+// vector per channel block in the conv epilogue
+void conv2d_bn_leaky_nchwc(
+    const float* input, float* output, const float* packed_weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bn_scale, const float* bn_bias, const float* bn_mean, const float* bn_var,
+    float epsilon, float alpha){
+
+    const size_t cp = (out_channels + YOLO_NCHWC_BLOCK - 1) / YOLO_NCHWC_BLOCK * YOLO_NCHWC_BLOCK;
+    std::vector<float> scale(cp, 0.0f), shift(cp, 0.0f);
+    for (int c = 0; c < out_channels; ++c) {
+        scale[c] = bn_scale[c] / std::sqrt(bn_var[c] + epsilon);
+        shift[c] = bn_bias[c] - bn_mean[c] * scale[c];
+    }
 
-    gemm_blocked_e32m8(kernel, col_buf, gemm_buf, M, N, K, 
-                       GEMM_BLOCK_M, GEMM_BLOCK_N, GEMM_BLOCK_K); 
+    ConvGemmShape s = {(size_t)in_channels, (size_t)in_height, (size_t)in_width,
+                       (size_t)kernel_size, (size_t)kernel_size,
+                       (size_t)stride, (size_t)stride, (size_t)pad_top, (size_t)pad_left};
 
-    for (int m = 0; m < M; ++m) {
-        float b_val = has_bias ? bias[m] : 0.0f;
-        
-        float* src_ptr = &gemm_buf[m * N];
-        float* dst_ptr = &output[m * N];
-        
-        size_t n = 0;
-        while (n < N) {
-            size_t vl = SET_VECTOR_LENGTH<float, M8>(N - n);
-            
-            vfloat32m8_t v_data = VECTOR_LOAD<float, M8>(&src_ptr[n], vl);
-            
-            if (has_bias) {
-                v_data = VECTOR_ADD<float, M8>(v_data, b_val, vl);
-            }
-            
-            VECTOR_STORE<float, M8>(&dst_ptr[n], v_data, vl);
-            n += vl;
-        }
-    }
+    GemmEpilogue<float> ep;
+    ep.scale = scale.data();
+    ep.shift = shift.data();
+    ep.alpha = alpha;
+    conv2d_nchwc<M4, GEMM_EP_SCALE_SHIFT | GEMM_EP_LEAKY_RELU>(input, packed_weights, output, s,
+                                                               out_channels, YOLO_NCHWC_BLOCK, &ep);
+}
+
+void maxpool_nchwc(const float* input, float* output,
+                   int channels,
+                   int in_h, int in_w,
+                   int out_h, int out_w,
+                   int k_h, int k_w,
+                   int stride_h, int stride_w,
+                   int pad_h, int pad_w) {
+    maxpool_nchwc<M4>(input, output, channels, in_h, in_w, out_h, out_w,
+                      k_h, k_w, stride_h, stride_w, pad_h, pad_w, YOLO_NCHWC_BLOCK);
 }
 
 /************************************ Bias Add ************************************/
@@ -150,6 +150,65 @@ static std::vector<BoundingBox> non_max_suppression(std::vector<BoundingBox>& bo
 
 // --- 2. Main Inference Function (HEAVILY MODIFIED) ---
 
+// Activation layout of the network body: plain NCHW with the implicit-GEMM convolutions,
+// or, built with -DYOLO_NCHWC=1, blocked NCHW[YOLO_NCHWC_BLOCK] (the image is converted
+// after preprocessing and the output before decoding). The GEMM path stays the default
+// until the blocked one is benchmarked on hardware. Conv weights are packed to match at
+// load time.
+#ifndef YOLO_NCHWC
+#define YOLO_NCHWC 0
+#endif
+
+static void conv_bn_leaky_layer(
+    const float* input, float* output, const float* weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bn_scale, const float* bn_bias, const float* bn_mean, const float* bn_var,
+    float epsilon, float alpha, const WinogradConvWeights* winograd) {
+#if YOLO_NCHWC
+    conv2d_bn_leaky_nchwc(input, output, weights, in_channels, in_height, in_width,
+                          out_channels, out_height, out_width, kernel_size, stride, pad_top, pad_left,
+                          bn_scale, bn_bias, bn_mean, bn_var, epsilon, alpha);
+#else
+    conv2d_bn_leaky(input, output, weights, in_channels, in_height, in_width,
+                    out_channels, out_height, out_width, kernel_size, stride, pad_top, pad_left,
+                    bn_scale, bn_bias, bn_mean, bn_var, epsilon, alpha, winograd);
+#endif
+}
+
+static void conv_layer(
+    const float* input, float* output, const float* weights,
+    int in_channels, int in_height, int in_width,
+    int out_channels, int out_height, int out_width,
+    int kernel_size, int stride, int pad_top, int pad_left,
+    const float* bias) {
+#if YOLO_NCHWC
+    conv2d_nchwc(input, output, weights, in_channels, in_height, in_width,
+                 out_channels, out_height, out_width, kernel_size, stride, pad_top, pad_left, bias);
+#else
+    conv2d(input, output, weights, in_channels, in_height, in_width,
+           out_channels, out_height, out_width, kernel_size, stride, pad_top, pad_left, bias);
+#endif
+}
+
+// out_h / out_w are explicit: the last pool pads only at the end (SAME_UPPER)
+static void maxpool_layer(const float* input, float* output,
+                          int channels, int in_h, int in_w, int out_h, int out_w,
+                          int k_h, int k_w, int stride_h, int stride_w, int pad_h, int pad_w) {
+#if YOLO_NCHWC
+    maxpool_nchwc(input, output, channels, in_h, in_w, out_h, out_w,
+                  k_h, k_w, stride_h, stride_w, pad_h, pad_w);
+#else
+    if (out_h == (in_h + 2 * pad_h - k_h) / stride_h + 1 && out_w == (in_w + 2 * pad_w - k_w) / stride_w + 1) {
+        maxpool_e32m8(input, output, 1, channels, in_h, in_w, k_h, k_w, stride_h, stride_w, pad_h, pad_w);
+    } else {
+        maxpool_e32m8_fixed(input, output, 1, channels, in_h, in_w, out_h, out_w,
+                            k_h, k_w, stride_h, stride_w, pad_h, pad_w);
+    }
+#endif
+}
+
 std::vector<BoundingBox> yolo_model_inference(
     const ModelWeights& w,
     const std::vector<float>& input_image)
@@ -180,108 +239,110 @@ std::vector<BoundingBox> yolo_model_inference(
     
     preprocess_image(buf_a.data(), w.pp_scale.data(), w.pp_bias.data(), 3, 416, 416);
     in_ptr = buf_a.data(); 
+
+#if YOLO_NCHWC
+    // The 3-channel image takes a whole channel block per pixel once blocked
+    static std::vector<float> buf_in((size_t)YOLO_NCHWC_BLOCK * 416 * 416);
+    nchw_to_nchwc(buf_a.data(), buf_in.data(), 3, 416, 416);
+    in_ptr = buf_in.data();
+#endif
     
     // --- 3. Model Body ---
 
     // Layer 0: Conv(16) -> BN -> Leaky
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv0_w.data(), 3, 416, 416, 16, 416, 416, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn0_s.data(), w.bn0_b.data(), w.bn0_m.data(), w.bn0_v.data(), 16, 416, 416, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 16 * 416 * 416, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv0_w.data(), 3, 416, 416, 16, 416, 416, 3, 1, 1, 1,
+                    w.bn0_s.data(), w.bn0_b.data(), w.bn0_m.data(), w.bn0_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[0].get());
     in_ptr = buf_b.data();
 
     // Layer 1: MaxPool(k=2, s=2)
     out_ptr = buf_a.data();
-	maxpool_e32m8(in_ptr, out_ptr, 1, 16, 416, 416, 2, 2, 2, 2, 0, 0);
+    maxpool_layer(in_ptr, out_ptr, 16, 416, 416, 208, 208, 2, 2, 2, 2, 0, 0);
     in_ptr = buf_a.data();
 
     // Layer 2: Conv(32) -> BN -> Leaky
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv1_w.data(), 16, 208, 208, 32, 208, 208, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn1_s.data(), w.bn1_b.data(), w.bn1_m.data(), w.bn1_v.data(), 32, 208, 208, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 32 * 208 * 208, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv1_w.data(), 16, 208, 208, 32, 208, 208, 3, 1, 1, 1,
+                    w.bn1_s.data(), w.bn1_b.data(), w.bn1_m.data(), w.bn1_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[1].get());
     in_ptr = buf_b.data();
 
     // Layer 3: MaxPool(k=2, s=2)
     out_ptr = buf_a.data();
-	maxpool_e32m8(in_ptr, out_ptr, 1, 32, 208, 208, 2, 2, 2, 2, 0, 0);
+    maxpool_layer(in_ptr, out_ptr, 32, 208, 208, 104, 104, 2, 2, 2, 2, 0, 0);
     in_ptr = buf_a.data();
 
     // Layer 4: Conv(64) -> BN -> Leaky
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv2_w.data(), 32, 104, 104, 64, 104, 104, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn2_s.data(), w.bn2_b.data(), w.bn2_m.data(), w.bn2_v.data(), 64, 104, 104, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 64 * 104 * 104, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv2_w.data(), 32, 104, 104, 64, 104, 104, 3, 1, 1, 1,
+                    w.bn2_s.data(), w.bn2_b.data(), w.bn2_m.data(), w.bn2_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[2].get());
     in_ptr = buf_b.data();
 
     // Layer 5: MaxPool(k=2, s=2)
     out_ptr = buf_a.data();
-	maxpool_e32m8(in_ptr, out_ptr, 1, 64, 104, 104, 2, 2, 2, 2, 0, 0);
+    maxpool_layer(in_ptr, out_ptr, 64, 104, 104, 52, 52, 2, 2, 2, 2, 0, 0);
     in_ptr = buf_a.data();
 
     // Layer 6: Conv(128) -> BN -> Leaky
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv3_w.data(), 64, 52, 52, 128, 52, 52, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn3_s.data(), w.bn3_b.data(), w.bn3_m.data(), w.bn3_v.data(), 128, 52, 52, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 128 * 52 * 52, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv3_w.data(), 64, 52, 52, 128, 52, 52, 3, 1, 1, 1,
+                    w.bn3_s.data(), w.bn3_b.data(), w.bn3_m.data(), w.bn3_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[3].get());
     in_ptr = buf_b.data();
 
     // Layer 7: MaxPool(k=2, s=2)
     out_ptr = buf_a.data();
-	maxpool_e32m8(in_ptr, out_ptr, 1, 128, 52, 52, 2, 2, 2, 2, 0, 0);
+    maxpool_layer(in_ptr, out_ptr, 128, 52, 52, 26, 26, 2, 2, 2, 2, 0, 0);
     in_ptr = buf_a.data();
 
     // Layer 8: Conv(256) -> BN -> Leaky
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv4_w.data(), 128, 26, 26, 256, 26, 26, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn4_s.data(), w.bn4_b.data(), w.bn4_m.data(), w.bn4_v.data(), 256, 26, 26, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 256 * 26 * 26, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv4_w.data(), 128, 26, 26, 256, 26, 26, 3, 1, 1, 1,
+                    w.bn4_s.data(), w.bn4_b.data(), w.bn4_m.data(), w.bn4_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[4].get());
     in_ptr = buf_b.data();
 
     // Layer 9: MaxPool(k=2, s=2)
     out_ptr = buf_a.data();
-	maxpool_e32m8(in_ptr, out_ptr, 1, 256, 26, 26, 2, 2, 2, 2, 0, 0);
+    maxpool_layer(in_ptr, out_ptr, 256, 26, 26, 13, 13, 2, 2, 2, 2, 0, 0);
     in_ptr = buf_a.data();
 
     // Layer 10: Conv(512) -> BN -> Leaky
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv5_w.data(), 256, 13, 13, 512, 13, 13, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn5_s.data(), w.bn5_b.data(), w.bn5_m.data(), w.bn5_v.data(), 512, 13, 13, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 512 * 13 * 13, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv5_w.data(), 256, 13, 13, 512, 13, 13, 3, 1, 1, 1,
+                    w.bn5_s.data(), w.bn5_b.data(), w.bn5_m.data(), w.bn5_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[5].get());
     in_ptr = buf_b.data();
 
     // Layer 11: MaxPool(k=2, s=1, p=0)
     out_ptr = buf_a.data();
-	maxpool_e32m8_fixed(
-		in_ptr, out_ptr, 
-		1, 512,      
-		13, 13,      
-		13, 13,     
-		2, 2,        
-		1, 1,        
-		0, 0         
-	);
-	in_ptr = buf_a.data();
+    maxpool_layer(in_ptr, out_ptr, 512, 13, 13, 13, 13, 2, 2, 1, 1, 0, 0);
+    in_ptr = buf_a.data();
 
     // Layer 12: Conv(1024) -> BN -> Leaky
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv6_w.data(), 512, 13, 13, 1024, 13, 13, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn6_s.data(), w.bn6_b.data(), w.bn6_m.data(), w.bn6_v.data(), 1024, 13, 13, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 1024 * 13 * 13, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv6_w.data(), 512, 13, 13, 1024, 13, 13, 3, 1, 1, 1,
+                    w.bn6_s.data(), w.bn6_b.data(), w.bn6_m.data(), w.bn6_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[6].get());
     in_ptr = buf_b.data();
 
     // Layer 13: Conv(1024) -> BN -> Leaky
     out_ptr = buf_a.data();
-    conv2d(in_ptr, out_ptr, w.conv7_w.data(), 1024, 13, 13, 1024, 13, 13, 3, 1, 1, 1);
-    batch_norm_e32m8(out_ptr, out_ptr, w.bn7_s.data(), w.bn7_b.data(), w.bn7_m.data(), w.bn7_v.data(), 1024, 13, 13, 1e-5f);
-    leaky_relu_e32m8(out_ptr, out_ptr, 1024 * 13 * 13, 0.1f);
+    conv_bn_leaky_layer(in_ptr, out_ptr, w.conv7_w.data(), 1024, 13, 13, 1024, 13, 13, 3, 1, 1, 1,
+                    w.bn7_s.data(), w.bn7_b.data(), w.bn7_m.data(), w.bn7_v.data(), 1e-5f, 0.1f,
+                    w.conv_winograd[7].get());
     in_ptr = buf_a.data();
 
     // Layer 14: Final Conv(125) + Bias
     out_ptr = buf_b.data();
-    conv2d(in_ptr, out_ptr, w.conv8_w.data(), 1024, 13, 13, 125, 13, 13, 1, 1, 0, 0);
-	size_t channel_size = 13 * 13;
-    bias_add_e32m8(out_ptr, w.conv8_b.data(), out_ptr, 125, channel_size);
+    conv_layer(in_ptr, out_ptr, w.conv8_w.data(), 1024, 13, 13, 125, 13, 13, 1, 1, 0, 0, w.conv8_b.data());
+
+#if YOLO_NCHWC
+    nchwc_to_nchw(out_ptr, buf_a.data(), 125, 13, 13);
+    out_ptr = buf_a.data();
+#endif
 
     // --- 4. Post-processing ---
     std::vector<BoundingBox> boxes = decode_output(out_ptr, ANCHORS);
@@ -355,6 +416,33 @@ void load_all_weights(ModelWeights& w, const std::string& weight_dir) {
     // Layer 8 (Final)
     w.conv8_w = load_weights_from_bin(weight_dir + "convolution8_W.bin", 125*1024*1*1);
     w.conv8_b = load_weights_from_bin(weight_dir + "convolution8_B.bin", 125);
+
+#if YOLO_NCHWC
+    // Conv weights in the blocked layout of conv2d_nchwc, packed once per model load
+    w.conv0_w = pack_conv_weights_nchwc(w.conv0_w, 16, 3, 3);
+    w.conv1_w = pack_conv_weights_nchwc(w.conv1_w, 32, 16, 3);
+    w.conv2_w = pack_conv_weights_nchwc(w.conv2_w, 64, 32, 3);
+    w.conv3_w = pack_conv_weights_nchwc(w.conv3_w, 128, 64, 3);
+    w.conv4_w = pack_conv_weights_nchwc(w.conv4_w, 256, 128, 3);
+    w.conv5_w = pack_conv_weights_nchwc(w.conv5_w, 512, 256, 3);
+    w.conv6_w = pack_conv_weights_nchwc(w.conv6_w, 1024, 512, 3);
+    w.conv7_w = pack_conv_weights_nchwc(w.conv7_w, 1024, 1024, 3);
+    w.conv8_w = pack_conv_weights_nchwc(w.conv8_w, 125, 1024, 1);
+    w.conv8_b.resize((125 + YOLO_NCHWC_BLOCK - 1) / YOLO_NCHWC_BLOCK * YOLO_NCHWC_BLOCK, 0.0f);
+#elif YOLO_WINOGRAD
+    // Winograd filters of the 3x3 layers, transformed once per model load: F(4x4,3x3)
+    // down to the 26x26 layer, F(2x2,3x3) on the 13x13 ones
+    const std::vector<float>* conv_w[8] = {&w.conv0_w, &w.conv1_w, &w.conv2_w, &w.conv3_w,
+                                           &w.conv4_w, &w.conv5_w, &w.conv6_w, &w.conv7_w};
+    const int conv_in[8] = {3, 16, 32, 64, 128, 256, 512, 1024};
+    const int conv_out[8] = {16, 32, 64, 128, 256, 512, 1024, 1024};
+    const int conv_hw[8] = {416, 208, 104, 52, 26, 13, 13, 13};
+    for (int l = 0; l < 8; ++l) {
+        w.conv_winograd[l].reset(pack_winograd_weights(conv_w[l]->data(), conv_in[l], conv_out[l],
+                                                       conv_hw[l] >= 16 ? 4 : 2),
+                                 free_winograd_weights);
+    }
+#endif
     
     std::cout << "All weights loaded." << std::endl;
 }
\ No newline at end of file
@@ -419,17 +419,11 @@ def conv2d(input: np.ndarray, kernel: np.ndarray, bias: np.ndarray = None, strid
                                   N, C_in, C_out, H, W, kH, kW, stride_h, stride_w, pad_h, pad_w)
     elif variant == "im2col_M8":
         # Calculate buffer sizes for im2col_gemm
-        # col_buf: C_in * kH * kW * outH * outW
-        # gemm_buf: out_size (N * C_out * outH * outW) - usually handled internally by wrapper logic or separate buffer
-        
-        # The C++ function signature for im2col asks for specific buffers:
-        # float* col_buf, float* gemm_buf
+        # col_buf: C_in * kH * kW * outH * outW (the GEMM stores straight into out)
         
         col_len = C_in * kH * kW * out_h * out_w
-        gemm_len = N * C_out * out_h * out_w # Intermediate gemm output often same size as final output if no bias/transpose stuff
         
         col_buf = np.zeros(col_len, dtype=np.float32)
-        gemm_buf = np.zeros(gemm_len, dtype=np.float32)
         
         # Ensure bias is valid pointer (if None, create dummy or handle in wrapper if wrapper supports nullptr)
         # The wrapper definition for im2col accepts bias pointer. 
@@ -443,7 +437,7 @@ def conv2d(input: np.ndarray, kernel: np.ndarray, bias: np.ndarray = None, strid
 
         conv_wrapper.conv2d_im2col_gemm_m8(
             ptr_f32(input), ptr_f32(kernel), ptr_f32(actual_bias), ptr_f32(out),
-            ptr_f32(col_buf), ptr_f32(gemm_buf),
+            ptr_f32(col_buf),
             C_in, H, W, C_out, kH, kW,
             pad_h, pad_w, stride_h, stride_w, has_bias
         )
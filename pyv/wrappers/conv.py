@@ -44,7 +44,7 @@ for name in ("e32m1", "e32m2", "e32m4", "e32m8"):
 # 2. Im2Col Struct (Im2Col+GEMM)
 # -------------------------------------------------------------------------
 # void conv2d_im2col_gemm_*(const float* input, const float* weights, const float* bias,
-#                           float* output, float* col_buf, float* gemm_buf,
+#                           float* output, float* col_buf, [float* gemm_buf (scalar only),]
 #                           int C, int H, int W, int M, int KH, int KW,
 #                           int pad_h, int pad_w, int stride_h, int stride_w, int has_bias);
 
@@ -68,10 +68,15 @@ im2col_argtypes = [
     ctypes.c_int  # has_bias
 ]
 
-for name in ("conv2d_im2col_gemm_scalar", "conv2d_im2col_gemm_vector", "conv2d_im2col_gemm_m8"):
+# The vector / m8 variants store straight into output and take no gemm_buf
+im2col_fused_argtypes = im2col_argtypes[:5] + im2col_argtypes[6:]
+
+for name, argtypes in (("conv2d_im2col_gemm_scalar", im2col_argtypes),
+                       ("conv2d_im2col_gemm_vector", im2col_fused_argtypes),
+                       ("conv2d_im2col_gemm_m8", im2col_fused_argtypes)):
     try:
         func = getattr(_lib, name)
-        func.argtypes = im2col_argtypes
+        func.argtypes = argtypes
         func.restype = None
     except AttributeError:
         pass
@@ -132,8 +137,8 @@ def conv2d_e32m4(input_ptr, kernel_ptr, output_ptr, batch, in_c, out_c, in_h, in
 def conv2d_e32m8(input_ptr, kernel_ptr, output_ptr, batch, in_c, out_c, in_h, in_w, k_h, k_w, s_h, s_w, p_h, p_w):
     _lib.conv2d_e32m8(input_ptr, kernel_ptr, output_ptr, batch, in_c, out_c, in_h, in_w, k_h, k_w, s_h, s_w, p_h, p_w)
 
-def conv2d_im2col_gemm_m8(input_ptr, kernel_ptr, bias_ptr, output_ptr, col_buf_ptr, gemm_buf_ptr, in_c, in_h, in_w, out_c, k_h, k_w, p_h, p_w, s_h, s_w, has_bias):
-    _lib.conv2d_im2col_gemm_m8(input_ptr, kernel_ptr, bias_ptr, output_ptr, col_buf_ptr, gemm_buf_ptr, in_c, in_h, in_w, out_c, k_h, k_w, p_h, p_w, s_h, s_w, has_bias)
+def conv2d_im2col_gemm_m8(input_ptr, kernel_ptr, bias_ptr, output_ptr, col_buf_ptr, in_c, in_h, in_w, out_c, k_h, k_w, p_h, p_w, s_h, s_w, has_bias):
+    _lib.conv2d_im2col_gemm_m8(input_ptr, kernel_ptr, bias_ptr, output_ptr, col_buf_ptr, in_c, in_h, in_w, out_c, k_h, k_w, p_h, p_w, s_h, s_w, has_bias)
 
 # 3x3 Specialized Wrappers
 def conv2d_3x3_m1(input_ptr, kernel_ptr, output_ptr, h, w, use_padding):